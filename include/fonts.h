@@ -5,7 +5,18 @@
  * Fonts are stored in PROGMEM to save RAM on ESP8266
  * 
  * Font format: {width, height, first_char, last_char, data...}
- * Each character has a width byte followed by column data
+ * Each character has a width byte followed by column data. Every glyph
+ * occupies the same stride (1 + width * ceil(height / 8) bytes) regardless
+ * of its actual width, so glyph N starts at 4 + N * stride.
+ *
+ * Each raw table (e.g. font3x7Data) is wrapped in a Font descriptor
+ * (e.g. font3x7) with a compile-time glyph index, so width and offset
+ * lookups are O(1) and the table size is checked by the compiler.
+ *
+ * The compiler also transposes every glyph into rows (name##Rows): one
+ * FontRow per pixel row, rows * 8 per glyph, bit i = column i. That is the
+ * layout of the row-packed matrix buffer, so drawing a glyph row is a
+ * single masked OR.
  */
 
 #ifndef FONTS_H
@@ -13,7 +24,96 @@
 
 #include <Arduino.h>
 
-const uint8_t digits7x16[] PROGMEM = {7,16,'0',':',
+// ======================== GLYPH INDEX ========================
+
+struct FontGlyph {
+  uint16_t offset;  // Byte offset of the glyph's width byte in the font data
+  uint8_t width;    // Glyph width in columns
+};
+
+typedef uint8_t FontRow;    // One glyph pixel row, bit i = column i
+
+struct Font {
+  const uint8_t* data;     // Raw font table (PROGMEM)
+  uint8_t height;          // Glyph height in pixels
+  uint8_t rows;            // Bytes per column: ceil(height / 8)
+  char first;              // First character in the table
+  char last;               // Last character in the table
+  const FontGlyph* glyphs; // One entry per character, first..last
+  const FontRow* rowBits;  // rows * 8 entries per character, first..last (PROGMEM)
+};
+
+constexpr size_t fontGlyphCount(const uint8_t* font) {
+  return (size_t)(font[3] - font[2] + 1);
+}
+
+constexpr size_t fontStride(const uint8_t* font) {
+  return 1 + font[0] * ((font[1] + 7) / 8);
+}
+
+constexpr uint16_t fontGlyphOffset(const uint8_t* font, size_t index) {
+  return (uint16_t)(4 + index * fontStride(font));
+}
+
+// Pixel rows a glyph covers in the matrix (whole 8-row bands)
+constexpr size_t fontBandRows(const uint8_t* font) {
+  return ((font[1] + 7) / 8) * 8;
+}
+
+// Bits of pixel row r of a glyph, from column col onwards
+constexpr FontRow fontRowBits(const uint8_t* font, uint16_t offset, size_t r, int col) {
+  return col >= font[offset] ? 0 :
+         (FontRow)((((font[offset + 1 + col * ((font[1] + 7) / 8) + r / 8] >> (r % 8)) & 1) << col) |
+                   fontRowBits(font, offset, r, col + 1));
+}
+
+constexpr FontRow fontRow(const uint8_t* font, size_t index) {
+  return fontRowBits(font, fontGlyphOffset(font, index / fontBandRows(font)),
+                     index % fontBandRows(font), 0);
+}
+
+template <size_t N>
+struct FontGlyphTable {
+  FontGlyph glyphs[N];
+};
+
+template <size_t N>
+struct FontRowTable {
+  FontRow rows[N];
+};
+
+// Compile-time index sequence (std::index_sequence is C++14)
+template <size_t... I> struct GlyphIndexSeq {};
+template <size_t N, size_t... I> struct MakeGlyphIndexSeq : MakeGlyphIndexSeq<N - 1, N - 1, I...> {};
+template <size_t... I> struct MakeGlyphIndexSeq<0, I...> { typedef GlyphIndexSeq<I...> type; };
+
+template <size_t... I>
+constexpr FontGlyphTable<sizeof...(I)> makeFontGlyphTable(const uint8_t* font, GlyphIndexSeq<I...>) {
+  return FontGlyphTable<sizeof...(I)>{{ { fontGlyphOffset(font, I), font[fontGlyphOffset(font, I)] }... }};
+}
+
+template <size_t... I>
+constexpr FontRowTable<sizeof...(I)> makeFontRowTable(const uint8_t* font, GlyphIndexSeq<I...>) {
+  return FontRowTable<sizeof...(I)>{{ fontRow(font, I)... }};
+}
+
+// Declares <name>Glyphs, <name>Rows and the <name> descriptor for the raw table <name>Data
+#define DEFINE_FONT(name)                                                                    \
+  static_assert(sizeof(name##Data) == 4 + fontGlyphCount(name##Data) * fontStride(name##Data), \
+                #name ": table size doesn't match its header");                              \
+  static_assert(name##Data[0] <= 8 * sizeof(FontRow), #name ": glyphs wider than a FontRow");  \
+  constexpr FontGlyphTable<fontGlyphCount(name##Data)> name##Glyphs =                        \
+      makeFontGlyphTable(name##Data, MakeGlyphIndexSeq<fontGlyphCount(name##Data)>::type()); \
+  constexpr FontRowTable<fontGlyphCount(name##Data) * fontBandRows(name##Data)> name##Rows PROGMEM = \
+      makeFontRowTable(name##Data,                                                           \
+                       MakeGlyphIndexSeq<fontGlyphCount(name##Data) * fontBandRows(name##Data)>::type()); \
+  constexpr Font name = { name##Data, name##Data[1], (uint8_t)((name##Data[1] + 7) / 8),      \
+                          (char)name##Data[2], (char)name##Data[3], name##Glyphs.glyphs,      \
+                          name##Rows.rows }
+
+// ======================== FONT DATA ========================
+
+constexpr uint8_t digits7x16Data[] PROGMEM = {7,16,'0',':',
 0x07, 0xFC, 0x3F, 0xFE, 0x7F, 0x03, 0xC0, 0x01, 0x80, 0x03, 0xC0, 0xFE, 0x7F, 0xFC, 0x3F,  // Code for char 0
 0x05, 0x08, 0x00, 0x0C, 0x00, 0x06, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,  // Code for char 1
 0x07, 0x02, 0xE0, 0x03, 0xF8, 0x01, 0x9E, 0x81, 0x87, 0xE3, 0x81, 0x7E, 0x80, 0x1C, 0x80,  // Code for char 2
@@ -27,7 +127,7 @@ const uint8_t digits7x16[] PROGMEM = {7,16,'0',':',
 0x01, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00   // Code for char :
 };
 
-const uint8_t digits5x16rn[] PROGMEM = {5,16,'0',':',
+constexpr uint8_t digits5x16rnData[] PROGMEM = {5,16,'0',':',
 0x05, 0xFE, 0x7F, 0x01, 0x80, 0x01, 0x80, 0xFF, 0xFF, 0xFE, 0x7F,
 0x04, 0x04, 0x00, 0x02, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
 0x05, 0x02, 0xFF, 0x81, 0x80, 0x81, 0x80, 0xFF, 0x80, 0x7E, 0x80, 
@@ -41,7 +141,7 @@ const uint8_t digits5x16rn[] PROGMEM = {5,16,'0',':',
 0x01, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 
 };
 
-const uint8_t font3x7[] PROGMEM = {5,7,' ','_',
+constexpr uint8_t font3x7Data[] PROGMEM = {5,7,' ','_',
 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,      // Code for char  
 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,      // Code for char !
 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,      // Code for char "
@@ -109,7 +209,7 @@ const uint8_t font3x7[] PROGMEM = {5,7,' ','_',
 };
 
 
-const uint8_t digits3x5[] PROGMEM = { 3,5,'0','9',
+constexpr uint8_t digits3x5Data[] PROGMEM = { 3,5,'0','9',
 0x03, 0xF8, 0x88, 0xF8, 
 //0x02, 0x10, 0xF8, 0x00, 
 0x03, 0, 0x10, 0xF8, 
@@ -123,7 +223,7 @@ const uint8_t digits3x5[] PROGMEM = { 3,5,'0','9',
 0x03, 0xB8, 0xA8, 0xF8, 
 };
 
-const uint8_t digits5x8rn[] PROGMEM = { 5,8,' ',':',
+constexpr uint8_t digits5x8rnData[] PROGMEM = { 5,8,' ',':',
 0, 0,0,0,0,0, // space
 1, B01011111, B00000000, B00000000,0,0,  // !
 3, B00000011, B00000000, B00000011,0,0, // "
@@ -153,4 +253,12 @@ const uint8_t digits5x8rn[] PROGMEM = { 5,8,' ',':',
 1, B00100100, B00000000, B00000000, B00000000, B00000000, // :
 };
 
+// ======================== FONT DESCRIPTORS ========================
+
+DEFINE_FONT(digits7x16);
+DEFINE_FONT(digits5x16rn);
+DEFINE_FONT(font3x7);
+DEFINE_FONT(digits3x5);
+DEFINE_FONT(digits5x8rn);
+
 #endif // FONTS_H
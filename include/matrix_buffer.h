@@ -0,0 +1,148 @@
+/*
+ * matrix_buffer.h - Virtual LED matrix storage and geometry
+ *
+ * MatrixBuffer<W, H> is a W x H LED matrix built from 8x8 modules. It is
+ * stored row-major and word-packed: WORDS uint32_t per LED row, bit n of
+ * word k = column k * 32 + n. Clearing, inverting, scrolling and comparing
+ * are a few word operations per row, and a glyph row is one masked OR.
+ *
+ * The wire formats (/api/display*, event streams) keep the MAX7219 column
+ * layout - one byte per column per 8-LED band, bit n = LED row n within
+ * the band, bands top to bottom - which columnByte()/toColumns() produce.
+ * All geometry is constexpr, so loops over it unroll to constants and
+ * checks against it fold away at compile time.
+ *
+ * Usage:
+ *   typedef MatrixBuffer<32, 16> Matrix;
+ *   Matrix scr;
+ *   scr.writeRow(x, y, glyphRowBits, width);
+ *   scr.scrollLeft();
+ *   uint32_t cols = scr.window(y, x);   // 32 columns from x on
+ *   static_assert(Matrix::contains(31, 15), "");
+ */
+
+#ifndef MATRIX_BUFFER_H
+#define MATRIX_BUFFER_H
+
+#include <stdint.h>
+#include <string.h>
+
+template <int W, int H>
+class MatrixBuffer {
+ public:
+  static_assert(W > 0 && W % 8 == 0, "matrix width must be whole 8x8 modules");
+  static_assert(H > 0 && H % 8 == 0, "matrix height must be whole 8x8 modules");
+
+  static constexpr int WIDTH = W;             // LED columns
+  static constexpr int HEIGHT = H;            // LED rows
+  static constexpr int BAND_HEIGHT = 8;       // LED rows per module row
+  static constexpr int BANDS = H / 8;         // Module rows
+  static constexpr int MODULES = (W / 8) * BANDS;
+  static constexpr int WORDS = (W + 31) / 32; // uint32_t per LED row
+  static constexpr int SIZE = W * BANDS;      // Bytes in the column (wire) layout
+
+  // Wire layout: byte holding column x of band
+  static constexpr int index(int x, int band) { return band * W + x; }
+  static constexpr int bandOf(int y) { return y / BAND_HEIGHT; }
+  static constexpr int bitOf(int y) { return y % BAND_HEIGHT; }
+  static constexpr bool contains(int x, int y) { return x >= 0 && x < W && y >= 0 && y < H; }
+
+  // Bits of word k that are real columns
+  static constexpr uint32_t wordMask(int k) {
+    return (k < W / 32) ? 0xFFFFFFFFu : ((1u << (W % 32)) - 1);
+  }
+
+  bool lit(int x, int y) const { return (rows[y][x / 32] >> (x % 32)) & 1; }
+
+  // Replace count (<= 32) columns of row y from x on: bit i of bits -> column x + i.
+  // Columns off either edge are dropped.
+  void writeRow(int x, int y, uint32_t bits, int count) {
+    if (x < 0) {
+      if (-x >= count) return;
+      bits >>= -x;
+      count += x;
+      x = 0;
+    }
+    if (x + count > W) count = W - x;
+    if (count <= 0) return;
+
+    uint64_t mask = (count >= 32 ? 0xFFFFFFFFull : ((1ull << count) - 1)) << (x % 32);
+    uint64_t value = ((uint64_t)bits << (x % 32)) & mask;
+    uint32_t* word = &rows[y][x / 32];
+    word[0] = (word[0] & ~(uint32_t)mask) | (uint32_t)value;
+    if (mask >> 32) {
+      word[1] = (word[1] & ~(uint32_t)(mask >> 32)) | (uint32_t)(value >> 32);
+    }
+  }
+
+  void clear() { memset(rows, 0, sizeof(rows)); }
+
+  void invert() {
+    for (int y = 0; y < H; y++) {
+      for (int k = 0; k < WORDS; k++) rows[y][k] = ~rows[y][k] & wordMask(k);
+    }
+  }
+
+  // Move every row one column left; the rightmost column comes in blank
+  void scrollLeft() {
+    for (int y = 0; y < H; y++) {
+      for (int k = 0; k < WORDS; k++) {
+        uint32_t carry = (k + 1 < WORDS) ? rows[y][k + 1] << 31 : 0;
+        rows[y][k] = (rows[y][k] >> 1) | carry;
+      }
+    }
+  }
+
+  // Columns x..x+31 of row y as one word; columns outside the matrix read as 0
+  uint32_t window(int y, int x) const {
+    if (x <= -32 || x >= W) return 0;
+    if (x < 0) return window(y, 0) << -x;
+    int k = x / 32;
+    uint64_t bits = rows[y][k] | (k + 1 < WORDS ? (uint64_t)rows[y][k + 1] << 32 : 0);
+    return (uint32_t)(bits >> (x % 32));
+  }
+
+  // Column byte i of the wire layout (see index())
+  uint8_t columnByte(int i) const {
+    int x = i % W;
+    int y0 = (i / W) * BAND_HEIGHT;
+    uint8_t value = 0;
+    for (int bit = 0; bit < BAND_HEIGHT; bit++) {
+      value |= (uint8_t)(lit(x, y0 + bit) << bit);
+    }
+    return value;
+  }
+
+  // Whole buffer in the wire layout, SIZE bytes
+  void toColumns(uint8_t* out) const {
+    for (int i = 0; i < SIZE; i++) out[i] = columnByte(i);
+  }
+
+  // Load the whole buffer from SIZE bytes in the wire layout
+  void fromColumns(const uint8_t* in) {
+    clear();
+    for (int i = 0; i < SIZE; i++) {
+      int x = i % W;
+      int y0 = (i / W) * BAND_HEIGHT;
+      for (int bit = 0; bit < BAND_HEIGHT; bit++) {
+        if ((in[i] >> bit) & 1) rows[y0 + bit][x / 32] |= 1u << (x % 32);
+      }
+    }
+  }
+
+  bool operator==(const MatrixBuffer& other) const { return memcmp(rows, other.rows, sizeof(rows)) == 0; }
+  bool operator!=(const MatrixBuffer& other) const { return !(*this == other); }
+
+  uint32_t rows[H][WORDS];
+};
+
+// Out-of-class definitions so the constants can be bound to references (C++11)
+template <int W, int H> constexpr int MatrixBuffer<W, H>::WIDTH;
+template <int W, int H> constexpr int MatrixBuffer<W, H>::HEIGHT;
+template <int W, int H> constexpr int MatrixBuffer<W, H>::BAND_HEIGHT;
+template <int W, int H> constexpr int MatrixBuffer<W, H>::BANDS;
+template <int W, int H> constexpr int MatrixBuffer<W, H>::MODULES;
+template <int W, int H> constexpr int MatrixBuffer<W, H>::WORDS;
+template <int W, int H> constexpr int MatrixBuffer<W, H>::SIZE;
+
+#endif // MATRIX_BUFFER_H
@@ -0,0 +1,107 @@
+/*
+ * perf_stats.h - Lightweight timing statistics
+ *
+ * PerfStat keeps count/min/max/average and a log-linear histogram of
+ * recorded values (four sub-buckets per power of two, so percentiles are
+ * accurate to within 25%). Recording is a handful of instructions and
+ * never allocates. PerfScope records the CPU cycles spent in a C++ scope.
+ *
+ * Each PerfStat should be written by a single task; readers on another
+ * task may see a sample half-applied, which is fine for telemetry.
+ *
+ * Usage:
+ *   PerfStat renderStat;
+ *   { PerfScope scope(renderStat); render(); }
+ *   renderStat.percentile(99);   // in cycles
+ */
+
+#ifndef PERF_STATS_H
+#define PERF_STATS_H
+
+#include <Arduino.h>
+
+class PerfStat {
+ public:
+  static const int BUCKETS = 124;  // Exact 0..3, then 4 per octave up to 2^32
+
+  PerfStat() { reset(); }
+
+  void record(uint32_t value) {
+    if (count == 0 || value < minValue) minValue = value;
+    if (value > maxValue) maxValue = value;
+    count++;
+    total += value;
+
+    // Halve the histogram when a bucket saturates; keeps the shape
+    if (++buckets[bucketOf(value)] == 0xFFFF) {
+      for (int i = 0; i < BUCKETS; i++) buckets[i] >>= 1;
+    }
+  }
+
+  void reset() {
+    count = 0;
+    total = 0;
+    minValue = 0;
+    maxValue = 0;
+    memset(buckets, 0, sizeof(buckets));
+  }
+
+  uint32_t samples() const { return count; }
+  uint32_t min() const { return minValue; }
+  uint32_t max() const { return maxValue; }
+  uint32_t average() const { return count ? (uint32_t)(total / count) : 0; }
+
+  // Upper bound of the bucket holding the pct-th percentile, capped at max()
+  uint32_t percentile(uint8_t pct) const {
+    uint32_t histogramTotal = 0;
+    for (int i = 0; i < BUCKETS; i++) histogramTotal += buckets[i];
+    if (histogramTotal == 0) return 0;
+
+    uint32_t target = (histogramTotal * pct + 99) / 100;
+    uint32_t seen = 0;
+    for (int i = 0; i < BUCKETS; i++) {
+      seen += buckets[i];
+      if (seen >= target) {
+        uint32_t upper = bucketUpper(i);
+        return upper < maxValue ? upper : maxValue;
+      }
+    }
+    return maxValue;
+  }
+
+ private:
+  static int bucketOf(uint32_t value) {
+    if (value < 4) return value;
+    int octave = 31 - __builtin_clz(value);             // >= 2
+    int sub = (value >> (octave - 2)) & 0x3;
+    return (octave - 1) * 4 + sub;
+  }
+
+  static uint32_t bucketUpper(int bucket) {
+    if (bucket < 4) return bucket;
+    int octave = bucket / 4 + 1;
+    int sub = bucket % 4;
+    uint64_t lower = (uint64_t)(4 + sub) << (octave - 2);
+    uint64_t upper = lower + ((uint64_t)1 << (octave - 2)) - 1;
+    return upper > 0xFFFFFFFFull ? 0xFFFFFFFFu : (uint32_t)upper;
+  }
+
+  uint32_t count;
+  uint64_t total;
+  uint32_t minValue;
+  uint32_t maxValue;
+  uint16_t buckets[BUCKETS];
+};
+
+// Records the CPU cycles between construction and destruction
+class PerfScope {
+ public:
+  explicit PerfScope(PerfStat& stat) : stat(stat), start(ESP.getCycleCount()) {}
+  ~PerfScope() { stat.record(ESP.getCycleCount() - start); }
+
+ private:
+  PerfStat& stat;
+  uint32_t start;
+};
+
+#endif // PERF_STATS_H
@@ -0,0 +1,80 @@
+/*
+ * scheduler.h - Deadline-ordered periodic timers
+ *
+ * Holds a fixed number of periodic callbacks. run() fires every timer
+ * that is due, earliest deadline first, and returns how many ms the
+ * caller can sleep before the next one is due - so a task can block
+ * instead of re-checking each interval on every pass.
+ *
+ * Times are millis() values; comparisons are wrap-safe. Timers that fall
+ * more than a period behind are re-based rather than fired repeatedly.
+ *
+ * Usage:
+ *   DeadlineScheduler<4> timers;
+ *   timers.add(readSensor, 60000, millis());
+ *   for (;;) vTaskDelay(pdMS_TO_TICKS(timers.run(millis())));
+ */
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <stdint.h>
+
+template <int N>
+class DeadlineScheduler {
+ public:
+  typedef void (*Callback)();
+
+  DeadlineScheduler() : count(0) {}
+
+  // First run is one period after now. Returns the timer id, or -1 if full.
+  int add(Callback callback, uint32_t periodMs, uint32_t now) {
+    if (count >= N) return -1;
+    Timer& t = timers[count];
+    t.callback = callback;
+    t.periodMs = periodMs;
+    t.deadline = now + periodMs;
+    return count++;
+  }
+
+  // Make a timer due immediately; its period restarts from that run
+  void trigger(int id, uint32_t now) {
+    if (id >= 0 && id < count) timers[id].deadline = now;
+  }
+
+  // Fire due timers in deadline order; returns ms until the next deadline
+  uint32_t run(uint32_t now) {
+    for (;;) {
+      int next = earliest();
+      if (next < 0) return UINT32_MAX;
+
+      Timer& t = timers[next];
+      int32_t remaining = (int32_t)(t.deadline - now);
+      if (remaining > 0) return (uint32_t)remaining;
+
+      t.deadline += t.periodMs;
+      if ((int32_t)(t.deadline - now) <= 0) t.deadline = now + t.periodMs;
+      t.callback();
+    }
+  }
+
+ private:
+  struct Timer {
+    Callback callback;
+    uint32_t periodMs;
+    uint32_t deadline;
+  };
+
+  int earliest() const {
+    int best = -1;
+    for (int i = 0; i < count; i++) {
+      if (best < 0 || (int32_t)(timers[i].deadline - timers[best].deadline) < 0) best = i;
+    }
+    return best;
+  }
+
+  Timer timers[N];
+  int count;
+};
+
+#endif // SCHEDULER_H
@@ -0,0 +1,164 @@
+/*
+ * sensor_history.h - Fixed-size multi-resolution sensor history
+ *
+ * A HistoryTier keeps the last N slots of one resolution (e.g. 1440
+ * one-minute slots = 24h) in a ring of compact 6-byte samples. Readings
+ * are averaged into the open slot as they arrive; when a reading lands in
+ * a later slot, the open one is closed, stored, and handed back so it can
+ * be fed into the next, coarser tier. Slots with no readings are stored
+ * as gaps. Nothing allocates after construction.
+ *
+ * Values are int16 fixed point, offset from a reference so pressure fits:
+ *   temp  0.01 degC     hum  0.01 %RH     pres  0.01 hPa from 1000 hPa
+ * HISTORY_NONE marks a missing value (no reading, or no pressure sensor).
+ *
+ * Usage:
+ *   HistoryTier<1440> minutes(60);
+ *   HistoryTier<2880> quarters(900);
+ *   HistorySample closed; uint32_t closedAt;
+ *   if (minutes.add(now, sample, closed, closedAt)) quarters.add(closedAt, closed, ...);
+ */
+
+#ifndef SENSOR_HISTORY_H
+#define SENSOR_HISTORY_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define HISTORY_NONE INT16_MIN
+
+struct HistorySample {
+  int16_t temp;
+  int16_t hum;
+  int16_t pres;
+};
+
+inline int16_t historyEncode(float value, float reference) {
+  if (value != value) return HISTORY_NONE;  // NaN
+  float scaled = (value - reference) * 100.0f;
+  if (scaled <= -32767.0f || scaled >= 32767.0f) return HISTORY_NONE;
+  return (int16_t)(scaled < 0 ? scaled - 0.5f : scaled + 0.5f);
+}
+
+inline HistorySample historySample(float temp, float hum, float pres) {
+  HistorySample s;
+  s.temp = historyEncode(temp, 0.0f);
+  s.hum = historyEncode(hum, 0.0f);
+  s.pres = historyEncode(pres, 1000.0f);
+  return s;
+}
+
+template <int N>
+class HistoryTier {
+ public:
+  static const int CAPACITY = N;
+
+  explicit HistoryTier(uint32_t periodS)
+      : periodS(periodS), newest(0), count(0), storedSlot(0), openSlot(0) {
+    resetOpen();
+  }
+
+  uint32_t period() const { return periodS; }
+  int size() const { return count; }
+
+  // Start time (epoch seconds) of the oldest and newest stored slots
+  uint32_t oldestTime() const { return (storedSlot - (count ? count - 1 : 0)) * periodS; }
+  uint32_t newestTime() const { return storedSlot * periodS; }
+
+  // Sample `age` slots before the newest stored one (0 = newest)
+  HistorySample at(int age) const {
+    int index = newest - age;
+    if (index < 0) index += N;
+    return slots[index];
+  }
+
+  // Average a sample into the slot covering `now`. Returns true when that
+  // closed an earlier slot, which is stored and copied to closed/closedAt.
+  bool add(uint32_t now, const HistorySample& sample, HistorySample& closed, uint32_t& closedAt) {
+    uint32_t slot = now / periodS;
+    bool closedOne = false;
+
+    if (slotOpen && slot != openSlot) {
+      if (slot < openSlot) {
+        resetOpen();  // Clock stepped backwards: drop the open slot
+      } else {
+        closed = openAverage();
+        closedAt = openSlot * periodS;
+        store(openSlot, closed);
+        resetOpen();
+        closedOne = true;
+      }
+    }
+
+    openSlot = slot;
+    slotOpen = true;
+    accumulate(0, sample.temp);
+    accumulate(1, sample.hum);
+    accumulate(2, sample.pres);
+    return closedOne;
+  }
+
+ private:
+  void accumulate(int channel, int16_t value) {
+    if (value == HISTORY_NONE) return;
+    sums[channel] += value;
+    counts[channel]++;
+  }
+
+  int16_t averageOf(int channel) const {
+    if (counts[channel] == 0) return HISTORY_NONE;
+    int32_t sum = sums[channel];
+    int32_t n = counts[channel];
+    return (int16_t)((sum >= 0 ? sum + n / 2 : sum - n / 2) / n);
+  }
+
+  HistorySample openAverage() const {
+    HistorySample s;
+    s.temp = averageOf(0);
+    s.hum = averageOf(1);
+    s.pres = averageOf(2);
+    return s;
+  }
+
+  void resetOpen() {
+    slotOpen = false;
+    memset(sums, 0, sizeof(sums));
+    memset(counts, 0, sizeof(counts));
+  }
+
+  // Append a closed slot, filling any skipped slots with gaps
+  void store(uint32_t slot, const HistorySample& sample) {
+    if (count > 0 && slot <= storedSlot) return;  // Already covered
+    if (count > 0) {
+      uint32_t gap = slot - storedSlot - 1;
+      if (gap >= (uint32_t)N) {
+        count = 0;  // Everything stored is older than the ring reaches
+      } else {
+        HistorySample none = {HISTORY_NONE, HISTORY_NONE, HISTORY_NONE};
+        for (uint32_t i = 0; i < gap; i++) push(none);
+      }
+    }
+    push(sample);
+    storedSlot = slot;
+  }
+
+  void push(const HistorySample& sample) {
+    newest = (count == 0) ? 0 : (newest + 1) % N;
+    slots[newest] = sample;
+    if (count < N) count++;
+  }
+
+  HistorySample slots[N];
+  uint32_t periodS;
+  int newest;            // Ring index of the newest stored slot
+  int count;             // Stored slots, up to N
+  uint32_t storedSlot;   // Slot number (time / period) of slots[newest]
+
+  // Slot currently being averaged
+  uint32_t openSlot;
+  bool slotOpen;
+  int32_t sums[3];
+  uint16_t counts[3];
+};
+
+#endif // SENSOR_HISTORY_H
@@ -8,6 +8,8 @@
  * 1. Find the POSIX TZ string for your location
  * 2. Add entry to timezones[] array: {"City, Country", "TZ_STRING"}
  * 3. Increment will be automatic via sizeof calculation
+ * Every entry is checked at compile time: a malformed TZ string (or a name
+ * that would break the /api/timezones JSON) fails the build.
  * 
  * POSIX TZ String Format:
  * STDoffset[DST[offset],start[/time],end[/time]]
@@ -31,7 +33,7 @@ struct TimezoneInfo {
 
 // Expanded timezone array with 88 global timezones (organized by region)
 // Default timezone is index 0 (Sydney, Australia)
-const TimezoneInfo timezones[] = {
+constexpr TimezoneInfo timezones[] = {
   // ==================== AUSTRALIA & OCEANIA (0-11) ====================
   {"Sydney, Australia", "AEST-10AEDT,M10.1.0,M4.1.0/3"},  // INDEX 0 - DEFAULT
   {"Adelaide, Australia", "ACST-9:30ACDT,M10.1.0,M4.1.0/3"},
@@ -148,6 +150,81 @@ const TimezoneInfo timezones[] = {
 };
 
 // Calculate number of timezones automatically
-const int numTimezones = sizeof(timezones) / sizeof(timezones[0]);
+constexpr int numTimezones = sizeof(timezones) / sizeof(timezones[0]);
+
+// ======================== COMPILE-TIME VALIDATION ========================
+// A small constexpr parser for the TZ format above. Each step takes the
+// index to parse from and returns the index after what it matched, or -1.
+constexpr bool tzAlpha(char c) { return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z'); }
+constexpr bool tzDigit(char c) { return c >= '0' && c <= '9'; }
+constexpr int tzSkipAlpha(const char* s, int i) { return tzAlpha(s[i]) ? tzSkipAlpha(s, i + 1) : i; }
+constexpr int tzSkipDigits(const char* s, int i) { return tzDigit(s[i]) ? tzSkipDigits(s, i + 1) : i; }
+
+// One or more digits
+constexpr int tzNumber(const char* s, int i) {
+  return (i >= 0 && tzDigit(s[i])) ? tzSkipDigits(s, i + 1) : -1;
+}
+
+// Zone abbreviation: at least three letters
+constexpr int tzName(const char* s, int i) {
+  return (i >= 0 && tzSkipAlpha(s, i) - i >= 3) ? tzSkipAlpha(s, i) : -1;
+}
+
+// [+-]hh[:mm[:ss]]
+constexpr int tzMinSec(const char* s, int i) {
+  return (s[i] == ':' && tzDigit(s[i + 1]) && tzDigit(s[i + 2])) ? tzMinSec(s, i + 3) : i;
+}
+constexpr int tzHours(const char* s, int i) {
+  return (tzNumber(s, i) >= 0 && tzNumber(s, i) - i <= 3) ? tzMinSec(s, tzNumber(s, i)) : -1;
+}
+constexpr int tzOffset(const char* s, int i) {
+  return i < 0 ? -1 : tzHours(s, (s[i] == '+' || s[i] == '-') ? i + 1 : i);
+}
+
+// DST rule: Mm.w.d, Jn or n, each with an optional /time
+constexpr int tzDotNumber(const char* s, int i) {
+  return (i >= 0 && s[i] == '.') ? tzNumber(s, i + 1) : -1;
+}
+constexpr int tzRuleTime(const char* s, int i) {
+  return (i >= 0 && s[i] == '/') ? tzOffset(s, i + 1) : i;
+}
+constexpr int tzRule(const char* s, int i) {
+  return s[i] == 'M' ? tzRuleTime(s, tzDotNumber(s, tzDotNumber(s, tzNumber(s, i + 1))))
+                     : tzRuleTime(s, tzNumber(s, s[i] == 'J' ? i + 1 : i));
+}
+constexpr int tzSecondRule(const char* s, int i) {
+  return (i >= 0 && s[i] == ',') ? tzRule(s, i + 1) : -1;
+}
+constexpr int tzRules(const char* s, int i) {
+  return (i >= 0 && s[i] == ',') ? tzSecondRule(s, tzRule(s, i + 1)) : i;
+}
+
+// Optional DST part: name[offset][,start,end]
+constexpr int tzDstOffset(const char* s, int i) {
+  return (i < 0 || s[i] == ',' || s[i] == '\0') ? i : tzOffset(s, i);
+}
+constexpr int tzDst(const char* s, int i) {
+  return (i < 0 || s[i] == '\0') ? i : tzRules(s, tzDstOffset(s, tzName(s, i)));
+}
+
+constexpr bool tzStringValid(const char* s) {
+  return tzDst(s, tzOffset(s, tzName(s, 0))) >= 0 &&
+         s[tzDst(s, tzOffset(s, tzName(s, 0)))] == '\0';
+}
+
+// Names are sent verbatim inside JSON strings
+constexpr bool tzNameValid(const char* name, int i) {
+  return name[i] == '\0' ? i > 0
+                          : (name[i] != '"' && name[i] != '\\' && tzNameValid(name, i + 1));
+}
+
+constexpr bool timezonesValid(int i) {
+  return i >= numTimezones ||
+         (tzNameValid(timezones[i].name, 0) && tzStringValid(timezones[i].tzString) &&
+          timezonesValid(i + 1));
+}
+
+static_assert(timezonesValid(0), "timezones[] has an empty/unsafe name or a malformed POSIX TZ string");
+static_assert(numTimezones <= 256, "saved settings store the timezone index in one byte");
 
 #endif // TIMEZONES_H
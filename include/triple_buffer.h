@@ -0,0 +1,54 @@
+/*
+ * triple_buffer.h - Lock-free single-producer/single-consumer handoff
+ *
+ * Hands the latest value of T from one task to another without locks.
+ * The producer always has a private slot to write into, the consumer
+ * always has a stable slot to read from, and the third slot is swapped
+ * between them atomically. Intermediate values may be skipped; the
+ * consumer only ever sees complete, most-recent snapshots.
+ *
+ * Producer:  buf.back() = value;  buf.publish();
+ * Consumer:  if (buf.update()) use(buf.front());
+ */
+
+#ifndef TRIPLE_BUFFER_H
+#define TRIPLE_BUFFER_H
+
+#include <atomic>
+#include <stdint.h>
+
+template <typename T>
+class TripleBuffer {
+ public:
+  TripleBuffer() : backIndex(0), frontIndex(1), middle(2) {}
+
+  // Producer side: slot to fill before publish()
+  T& back() { return slots[backIndex]; }
+
+  // Producer side: make back() visible to the consumer
+  void publish() {
+    backIndex = middle.exchange(backIndex | DIRTY_BIT, std::memory_order_acq_rel) & INDEX_MASK;
+  }
+
+  // Consumer side: pick up the newest published slot, if any.
+  // Returns true when front() changed.
+  bool update() {
+    if ((middle.load(std::memory_order_acquire) & DIRTY_BIT) == 0) return false;
+    frontIndex = middle.exchange(frontIndex, std::memory_order_acq_rel) & INDEX_MASK;
+    return true;
+  }
+
+  // Consumer side: most recently picked-up value
+  const T& front() const { return slots[frontIndex]; }
+
+ private:
+  static const uint32_t INDEX_MASK = 0x3;
+  static const uint32_t DIRTY_BIT = 0x4;
+
+  T slots[3];
+  uint32_t backIndex;              // Owned by the producer
+  uint32_t frontIndex;             // Owned by the consumer
+  std::atomic<uint32_t> middle;    // Shared slot index + dirty flag
+};
+
+#endif // TRIPLE_BUFFER_H
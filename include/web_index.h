@@ -0,0 +1,502 @@
+/*
+ * web_index.h - Gzipped dashboard page served at /
+ *
+ * GENERATED by tools/build_web.py from web/index.html - do not edit.
+ */
+
+#ifndef WEB_INDEX_H
+#define WEB_INDEX_H
+
+#include <Arduino.h>
+
+#define WEB_INDEX_BUILD "96eb46f1"  // Content hash, also used as the ETag
+
+const size_t WEB_INDEX_GZ_LEN = 7734;
+const uint8_t WEB_INDEX_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x5c, 0x5b, 0x8f, 0xe3, 0xc8,
+  0x75, 0x7e, 0xef, 0x5f, 0x51, 0xe3, 0xb1, 0x87, 0xe2, 0x34, 0x25, 0x91, 0xd4, 0xa5, 0xd5, 0x52,
+  0x4b, 0xed, 0xbe, 0x69, 0x67, 0x8c, 0xb9, 0x34, 0xa6, 0x7b, 0xbc, 0x59, 0x0f, 0x06, 0x03, 0x4a,
+  0x2c, 0x49, 0xf4, 0x50, 0xa4, 0x4c, 0x52, 0xad, 0xd6, 0xf4, 0x0e, 0xe0, 0x00, 0xc9, 0x5b, 0x02,
+  0x03, 0x86, 0x01, 0x07, 0x48, 0x0c, 0x23, 0x40, 0x12, 0xbf, 0xee, 0x63, 0x9e, 0xd7, 0xff, 0xc4,
+  0x7f, 0x20, 0xf9, 0x09, 0x39, 0xe7, 0x54, 0x91, 0x2a, 0x52, 0x6a, 0x8d, 0x76, 0x3d, 0x9b, 0x27,
+  0xef, 0xa5, 0x25, 0x55, 0x9d, 0xaa, 0x3a, 0xf5, 0x9d, 0x4b, 0x9d, 0x53, 0x55, 0xe4, 0xd1, 0x83,
+  0xf3, 0x97, 0x67, 0xd7, 0x5f, 0x5d, 0x5e, 0xb0, 0x49, 0x32, 0xf5, 0x7b, 0x7b, 0x47, 0xe9, 0x07,
+  0x77, 0x5c, 0xf8, 0x98, 0xf2, 0xc4, 0x61, 0xc3, 0x89, 0x13, 0xc5, 0x3c, 0xe9, 0x6a, 0xaf, 0xaf,
+  0xfb, 0xe5, 0x96, 0x96, 0x16, 0x07, 0xce, 0x94, 0x77, 0xb5, 0x1b, 0x8f, 0x2f, 0x66, 0x61, 0x94,
+  0x68, 0x6c, 0x18, 0x06, 0x09, 0x0f, 0x80, 0x6c, 0xe1, 0xb9, 0xc9, 0xa4, 0xeb, 0xf2, 0x1b, 0x6f,
+  0xc8, 0xcb, 0xf4, 0xc3, 0x60, 0x5e, 0xe0, 0x25, 0x9e, 0xe3, 0x97, 0xe3, 0xa1, 0xe3, 0xf3, 0xae,
+  0x55, 0x31, 0xb1, 0x9b, 0xc4, 0x4b, 0x7c, 0xde, 0x3b, 0xfb, 0xea, 0x9c, 0x3d, 0xbb, 0x38, 0x67,
+  0x67, 0x7e, 0x38, 0x7c, 0x7f, 0x54, 0x15, 0x85, 0x7b, 0x47, 0x0f, 0xca, 0xe5, 0xbd, 0x73, 0x27,
+  0x9e, 0x0c, 0x42, 0x27, 0x72, 0xd9, 0xcc, 0x19, 0x73, 0x36, 0x0a, 0x23, 0x96, 0x4c, 0x38, 0x4b,
+  0x5b, 0x3c, 0x77, 0x92, 0xc8, 0xbb, 0x15, 0x0d, 0x2b, 0x7b, 0xd7, 0x13, 0x2f, 0x66, 0x23, 0xcf,
+  0xe7, 0x0c, 0x3e, 0xc7, 0x1f, 0xbc, 0xd9, 0x8c, 0xbb, 0x30, 0x6e, 0x12, 0xc2, 0x9f, 0xa1, 0x3f,
+  0x77, 0x79, 0x75, 0xc1, 0x07, 0xef, 0xbc, 0xc0, 0xe5, 0xb7, 0x95, 0x09, 0x1b, 0x2c, 0x59, 0x12,
+  0x86, 0x7e, 0x5c, 0x1d, 0xcc, 0x3d, 0xdf, 0x7d, 0x07, 0x55, 0x95, 0xd9, 0x72, 0xaf, 0x14, 0xcd,
+  0x03, 0xe6, 0xcc, 0x93, 0x70, 0xea, 0x24, 0x1e, 0xb0, 0xea, 0x2f, 0xd9, 0x80, 0xc3, 0xb0, 0x9c,
+  0x71, 0x67, 0x38, 0x61, 0x97, 0xbe, 0x93, 0xc0, 0xaf, 0xe9, 0xd3, 0x97, 0x8c, 0x9a, 0xe9, 0xcc,
+  0x09, 0x5c, 0x16, 0xf3, 0xe8, 0x06, 0x86, 0x1a, 0x45, 0xe1, 0x94, 0x8d, 0x7c, 0x60, 0xb9, 0xb2,
+  0x77, 0x71, 0xc3, 0xa3, 0x65, 0x32, 0xf1, 0x82, 0x31, 0x93, 0x38, 0xc4, 0x33, 0x3e, 0xf4, 0x46,
+  0xde, 0x10, 0x99, 0x1b, 0xf1, 0x64, 0x38, 0x49, 0x5b, 0x54, 0x9d, 0x99, 0x57, 0x05, 0xec, 0x46,
+  0xde, 0xd8, 0x10, 0x3f, 0x12, 0x6f, 0xca, 0x3f, 0x84, 0x01, 0x8f, 0xf7, 0xb0, 0x77, 0x2a, 0xe2,
+  0x37, 0x80, 0x6c, 0x6c, 0xb0, 0x38, 0x24, 0x00, 0x08, 0x0d, 0x2f, 0x89, 0xb9, 0x3f, 0x62, 0x01,
+  0xd4, 0x45, 0x28, 0xa3, 0x60, 0xcc, 0x63, 0xe6, 0x24, 0x0c, 0xa6, 0x80, 0x3d, 0x54, 0xf6, 0xca,
+  0x65, 0x80, 0x31, 0x4e, 0x96, 0x08, 0xe7, 0xe3, 0xbb, 0x41, 0x78, 0x5b, 0x8e, 0xbd, 0x0f, 0xc0,
+  0x52, 0x7b, 0x10, 0x46, 0x2e, 0x8f, 0xca, 0x50, 0xd2, 0xf9, 0xb8, 0x37, 0x08, 0xdd, 0xe5, 0xdd,
+  0x08, 0x64, 0x57, 0x1e, 0x39, 0x53, 0xcf, 0x5f, 0xb6, 0xb5, 0x2b, 0x3e, 0x0e, 0x39, 0x7b, 0xfd,
+  0x54, 0x33, 0x4e, 0x22, 0x90, 0x99, 0x11, 0x3b, 0x41, 0x5c, 0x86, 0x49, 0x7a, 0xa3, 0xce, 0xd4,
+  0x89, 0xc6, 0x5e, 0xd0, 0x36, 0x3b, 0x33, 0xc7, 0x75, 0xb1, 0x2b, 0xcb, 0x9c, 0xdd, 0x76, 0x06,
+  0xce, 0xf0, 0xfd, 0x38, 0x0a, 0xe7, 0x81, 0xdb, 0x7e, 0x68, 0x39, 0xf8, 0x6f, 0x67, 0x18, 0xfa,
+  0x61, 0xd4, 0x7e, 0x38, 0x1a, 0x61, 0x9b, 0x5b, 0xa1, 0x05, 0x6d, 0xcb, 0x36, 0x91, 0x3c, 0xed,
+  0x84, 0x80, 0x06, 0x0e, 0x2a, 0xa8, 0x6c, 0x3c, 0xba, 0x4b, 0xf8, 0x6d, 0x52, 0x76, 0x7c, 0x6f,
+  0x1c, 0xb4, 0x87, 0x30, 0x5d, 0x1e, 0x49, 0x4a, 0x60, 0x34, 0x01, 0x89, 0x40, 0xf3, 0x19, 0x32,
+  0x3c, 0xb1, 0xee, 0x94, 0xde, 0x89, 0x73, 0x98, 0x17, 0x6f, 0x0f, 0x7d, 0x67, 0x3a, 0x2b, 0xd9,
+  0x30, 0x82, 0xd1, 0xb8, 0x59, 0x18, 0x76, 0x73, 0x76, 0xab, 0x8b, 0xea, 0x05, 0xf7, 0xc6, 0x93,
+  0xa4, 0xdd, 0x34, 0xcd, 0xd5, 0xd8, 0x26, 0xb3, 0x1a, 0xb3, 0x5b, 0x66, 0xe2, 0xf8, 0x08, 0x57,
+  0xd9, 0xf5, 0xe2, 0x99, 0xef, 0x2c, 0xef, 0x94, 0xc9, 0xf8, 0x5e, 0xc0, 0x9d, 0xa8, 0x3c, 0x8e,
+  0x1c, 0xd7, 0x03, 0x86, 0x4a, 0x56, 0xad, 0xe1, 0xf2, 0xb1, 0xf1, 0xd0, 0x76, 0xf0, 0x5f, 0xe3,
+  0xa1, 0xc5, 0xf1, 0x5f, 0x3d, 0x03, 0x43, 0x70, 0x80, 0xfd, 0x1a, 0x75, 0xe4, 0xa0, 0x81, 0x1c,
+  0x48, 0xb0, 0xb1, 0x8f, 0x79, 0x2c, 0xe6, 0x40, 0xa2, 0x98, 0x38, 0x6e, 0xb8, 0x00, 0x46, 0xea,
+  0xc0, 0x85, 0x05, 0xbc, 0xb2, 0x68, 0x3c, 0x70, 0x4a, 0xa6, 0x41, 0xff, 0x56, 0x6a, 0xfa, 0xe6,
+  0xc9, 0xe7, 0x78, 0x65, 0x13, 0x3b, 0x85, 0xc2, 0x71, 0x9c, 0x35, 0x28, 0xac, 0xba, 0x64, 0xc4,
+  0x6a, 0x15, 0xa1, 0xa8, 0x17, 0xa0, 0x30, 0x09, 0x0a, 0x45, 0x00, 0x3e, 0x1f, 0x25, 0x38, 0xdc,
+  0x10, 0x6d, 0xeb, 0xae, 0xd8, 0x73, 0x1d, 0x41, 0xb6, 0x6c, 0xe8, 0xfa, 0xd0, 0x2c, 0x76, 0x7d,
+  0x60, 0xe6, 0x3a, 0xca, 0x49, 0xb2, 0x2d, 0x07, 0xca, 0xa9, 0xdb, 0x59, 0x38, 0x8f, 0x3c, 0x50,
+  0xe1, 0x17, 0x7c, 0xa1, 0x19, 0xd3, 0x30, 0x08, 0xe3, 0x99, 0x33, 0xe4, 0xa9, 0x06, 0x1d, 0x9c,
+  0xf5, 0xcf, 0xd2, 0x1e, 0x33, 0xcc, 0x4c, 0x86, 0x62, 0x16, 0x88, 0x59, 0x76, 0x1d, 0x90, 0xb6,
+  0x09, 0xb5, 0x86, 0xde, 0x41, 0x99, 0x95, 0x27, 0x82, 0x15, 0xab, 0x62, 0xe1, 0x1c, 0x5c, 0x27,
+  0xe1, 0x77, 0x1b, 0xf5, 0xa4, 0x09, 0x33, 0xa8, 0xb5, 0x36, 0xe9, 0xc9, 0x67, 0x9c, 0x41, 0xfd,
+  0xe4, 0xd0, 0xbc, 0xb0, 0xd7, 0x66, 0x40, 0xea, 0x47, 0x33, 0x38, 0xa8, 0x1b, 0x56, 0x1d, 0x26,
+  0x61, 0x37, 0x37, 0x4d, 0xc1, 0xc6, 0x29, 0xf0, 0xe0, 0xc6, 0x8b, 0xc2, 0x60, 0x0a, 0xac, 0x7c,
+  0x26, 0x05, 0xad, 0xfd, 0x50, 0x0a, 0xaa, 0xb0, 0xca, 0x66, 0x77, 0x12, 0xb5, 0x66, 0x6a, 0x6a,
+  0x50, 0x0b, 0xec, 0x7a, 0xee, 0x9d, 0x54, 0xe1, 0x36, 0xfe, 0xe8, 0xe0, 0x9f, 0x72, 0xc2, 0xa7,
+  0x50, 0x92, 0xf0, 0x32, 0xe0, 0x36, 0x9f, 0x06, 0x71, 0x3b, 0xe2, 0x33, 0xee, 0x24, 0x25, 0xf4,
+  0x12, 0xe5, 0x91, 0x97, 0x18, 0x53, 0x2f, 0x00, 0x5f, 0x02, 0x6a, 0x4d, 0xda, 0x37, 0x8a, 0x74,
+  0xbd, 0x33, 0x76, 0x66, 0xe9, 0xa4, 0xec, 0x74, 0x52, 0xa4, 0x91, 0xeb, 0xf2, 0x93, 0x83, 0x7b,
+  0x30, 0xcc, 0x5d, 0x01, 0x8f, 0xb4, 0xa9, 0x45, 0x2e, 0x43, 0xc1, 0x97, 0x66, 0x6c, 0x37, 0x1a,
+  0x46, 0xfa, 0xbf, 0x59, 0x31, 0x1b, 0x45, 0xc4, 0x40, 0x7f, 0x3a, 0x49, 0x04, 0x3e, 0x12, 0x56,
+  0xb8, 0x30, 0x68, 0xd3, 0x57, 0x5c, 0x24, 0x98, 0x59, 0xb1, 0x63, 0x75, 0xd8, 0xf6, 0x24, 0xbc,
+  0x41, 0x37, 0x97, 0x12, 0x08, 0x52, 0x9c, 0xf2, 0x57, 0xa5, 0x72, 0x6d, 0x87, 0xa1, 0x5b, 0x7a,
+  0xd6, 0x1d, 0x2c, 0x18, 0x6b, 0x2a, 0x5d, 0xc3, 0x79, 0xb4, 0x60, 0x1e, 0x75, 0x52, 0xe9, 0xbc,
+  0x78, 0x60, 0x6a, 0x9d, 0x14, 0xf3, 0x01, 0x1a, 0x75, 0xda, 0xd5, 0x8d, 0xe3, 0xcf, 0xef, 0x31,
+  0x0f, 0x74, 0xa3, 0xb5, 0x8d, 0x06, 0x9e, 0x13, 0xeb, 0x2e, 0xb6, 0xb0, 0x59, 0xa7, 0xcb, 0xbe,
+  0x33, 0xe0, 0xfe, 0xda, 0xe0, 0x96, 0x95, 0x0a, 0xa4, 0x8e, 0x83, 0x2b, 0x2e, 0x8e, 0xc4, 0xba,
+  0x02, 0x70, 0x0e, 0x6b, 0x7c, 0x34, 0x74, 0x62, 0xe8, 0x9f, 0x27, 0x20, 0xe4, 0x32, 0x0e, 0x86,
+  0x82, 0x05, 0x3b, 0x12, 0xda, 0x38, 0x84, 0xe0, 0xe1, 0x33, 0x58, 0x4c, 0x5e, 0x43, 0xe4, 0xec,
+  0x5b, 0x34, 0xfb, 0x75, 0x65, 0xc8, 0x59, 0x4f, 0x0d, 0xad, 0xc7, 0xde, 0x60, 0x3d, 0xb0, 0x90,
+  0xe5, 0xbc, 0x77, 0xb6, 0x28, 0x93, 0xb8, 0xb0, 0x45, 0x1c, 0xfa, 0x9e, 0xcb, 0x1e, 0xd6, 0xcf,
+  0x4e, 0xfa, 0x8d, 0x6c, 0xc5, 0x4d, 0x09, 0x00, 0x99, 0x75, 0x87, 0x9f, 0xae, 0x3c, 0xd6, 0x41,
+  0x51, 0x68, 0x8d, 0x8d, 0x0e, 0x1f, 0x56, 0xff, 0x39, 0xf4, 0x16, 0xa8, 0x08, 0xa5, 0xe3, 0x09,
+  0xd6, 0x16, 0x13, 0xd0, 0x5c, 0xc9, 0x5b, 0x3b, 0x80, 0xa0, 0x24, 0x43, 0xa6, 0x25, 0x27, 0xd6,
+  0x19, 0xce, 0xa3, 0x18, 0x28, 0x67, 0xa1, 0x47, 0x76, 0x96, 0xc7, 0xa3, 0xb1, 0x5a, 0xef, 0xd1,
+  0x8f, 0xa4, 0xff, 0x9b, 0xeb, 0xbc, 0x67, 0x10, 0x93, 0x25, 0xd0, 0xb8, 0x24, 0x4e, 0x0e, 0xc3,
+  0x2e, 0x22, 0x67, 0x96, 0x31, 0x2b, 0xcd, 0x28, 0xc7, 0x72, 0xc3, 0x31, 0xeb, 0x87, 0x40, 0x01,
+  0x11, 0x11, 0x1f, 0x26, 0x99, 0x7d, 0x37, 0x37, 0x81, 0x94, 0x1f, 0x28, 0x17, 0xbb, 0x90, 0xf0,
+  0xd5, 0xd8, 0x45, 0x4e, 0xdc, 0x52, 0xa4, 0x51, 0xaf, 0x6f, 0x98, 0xa2, 0x8c, 0x6f, 0x4c, 0xf3,
+  0x27, 0x4a, 0xb8, 0x63, 0xb7, 0x4c, 0x52, 0xc2, 0x59, 0x2a, 0xe6, 0xe1, 0x70, 0xb8, 0x85, 0x1d,
+  0xd2, 0xf5, 0xbc, 0x9d, 0x34, 0x3a, 0x45, 0xff, 0x19, 0x27, 0x4e, 0x32, 0x8f, 0xcb, 0x33, 0xcf,
+  0xf7, 0x33, 0x17, 0xea, 0x05, 0xd4, 0x4a, 0x58, 0x75, 0x3a, 0x75, 0xf2, 0xda, 0x14, 0x9c, 0xe5,
+  0x98, 0x3d, 0x3c, 0x3c, 0xcc, 0x61, 0x42, 0x12, 0x2c, 0x5a, 0xf7, 0x9a, 0x31, 0xd5, 0xb2, 0x7e,
+  0x54, 0x28, 0x6c, 0x7e, 0xe0, 0xd6, 0xec, 0x3c, 0x82, 0xa3, 0xda, 0xc0, 0xae, 0xa5, 0x08, 0x1e,
+  0x9e, 0xf5, 0xfb, 0x87, 0x67, 0x0a, 0xdb, 0xf1, 0x7c, 0x80, 0x16, 0x7c, 0x97, 0x77, 0x44, 0x1b,
+  0x43, 0x18, 0x62, 0x4c, 0xba, 0xb0, 0x24, 0x9c, 0x91, 0xbe, 0x43, 0x47, 0x41, 0x08, 0x6b, 0xf9,
+  0x27, 0xdc, 0x64, 0x5d, 0x57, 0x99, 0x75, 0x21, 0x20, 0x87, 0x58, 0xfb, 0x61, 0xa3, 0xd1, 0x50,
+  0x75, 0xb7, 0x80, 0x0b, 0x6a, 0xca, 0x46, 0x29, 0x15, 0xf9, 0xc0, 0xa6, 0x45, 0x21, 0x7d, 0xdc,
+  0xfb, 0xe9, 0x94, 0xbb, 0x9e, 0x53, 0x5a, 0xc9, 0xfe, 0xa0, 0x89, 0x3e, 0xf8, 0x4e, 0x59, 0xf0,
+  0x36, 0xaf, 0x71, 0xb0, 0x8c, 0xed, 0x12, 0x66, 0xb5, 0xc8, 0x0b, 0x7f, 0x3a, 0x96, 0x69, 0x0a,
+  0x32, 0x8a, 0xe9, 0xd5, 0xc9, 0x16, 0x02, 0x47, 0x43, 0x5d, 0xa5, 0x0d, 0xe1, 0x24, 0xb3, 0x88,
+  0x5e, 0xac, 0xe3, 0x1f, 0xf7, 0xaa, 0x8f, 0xd9, 0x75, 0xff, 0x9a, 0x9d, 0xcb, 0x58, 0xf3, 0xb9,
+  0x17, 0x45, 0x90, 0x7f, 0x51, 0x3e, 0x11, 0xb3, 0xc7, 0x55, 0xe8, 0x71, 0x94, 0x94, 0xa7, 0x54,
+  0xfa, 0x19, 0x3d, 0xac, 0x58, 0xbe, 0x3f, 0x67, 0x4c, 0xb2, 0x31, 0x14, 0x58, 0xf1, 0xce, 0x76,
+  0x74, 0xc3, 0x17, 0x87, 0xd6, 0x45, 0xb3, 0xf6, 0x83, 0xb8, 0xe1, 0x4d, 0x71, 0xb7, 0x13, 0xdc,
+  0x38, 0x71, 0x19, 0x73, 0x6a, 0x07, 0x00, 0x8d, 0x32, 0x93, 0x19, 0xf9, 0xfc, 0xb6, 0xf3, 0xcb,
+  0x79, 0x9c, 0x78, 0xa3, 0x65, 0x59, 0xa6, 0xdc, 0xe9, 0xbc, 0xa8, 0x0b, 0x0a, 0x35, 0xe2, 0xb4,
+  0x28, 0x27, 0x55, 0xd5, 0x52, 0x4d, 0x73, 0xd3, 0xd2, 0xa5, 0x28, 0xba, 0x25, 0x9c, 0xd7, 0x43,
+  0x40, 0xea, 0x8c, 0x98, 0xb9, 0xf3, 0xa6, 0x90, 0x76, 0x96, 0x23, 0x0e, 0x19, 0x74, 0x84, 0x7d,
+  0xce, 0xbc, 0x5b, 0x8e, 0xca, 0xec, 0x76, 0x8a, 0x35, 0xc3, 0x08, 0xb8, 0x2d, 0x73, 0x17, 0x32,
+  0xd2, 0xd4, 0x14, 0xed, 0x6d, 0x2e, 0xb4, 0x5e, 0x94, 0xaf, 0xc9, 0x5a, 0xa9, 0x70, 0x9b, 0x2d,
+  0x43, 0xfc, 0x47, 0xb1, 0xb1, 0x14, 0x9d, 0x88, 0x1b, 0xa4, 0xd8, 0x5a, 0xad, 0x96, 0x6a, 0xb0,
+  0xd6, 0xba, 0xc1, 0x42, 0xab, 0x51, 0x08, 0x9e, 0xe3, 0xaf, 0x52, 0x54, 0xd4, 0xb7, 0x2c, 0x0b,
+  0xc0, 0xe9, 0x20, 0x9b, 0xdf, 0x7f, 0xfd, 0xdf, 0xa8, 0x96, 0x82, 0xcb, 0x54, 0xae, 0x79, 0xa1,
+  0x6f, 0x90, 0xee, 0x3d, 0x7a, 0x80, 0x51, 0x31, 0x32, 0x82, 0xcd, 0xca, 0xb8, 0x76, 0xb6, 0x69,
+  0x01, 0xdd, 0x1c, 0xaf, 0xcb, 0x21, 0x01, 0x8d, 0xf7, 0x29, 0xa0, 0x32, 0x02, 0x20, 0x0e, 0x5d,
+  0x3e, 0x0c, 0x23, 0x87, 0x22, 0x5b, 0x5a, 0xfe, 0x37, 0x26, 0x99, 0xb5, 0x4a, 0x23, 0x0b, 0x8e,
+  0x8a, 0xea, 0xae, 0x84, 0xc6, 0xd4, 0x3d, 0x84, 0xc5, 0xb5, 0xb8, 0x30, 0xb0, 0x5c, 0xd2, 0xe5,
+  0xf0, 0xcd, 0xe6, 0xe9, 0x69, 0xf3, 0x44, 0x21, 0x89, 0xf9, 0xcc, 0x01, 0x1e, 0x42, 0x85, 0xa2,
+  0xf9, 0x69, 0x46, 0x56, 0xed, 0x27, 0x20, 0xe7, 0x24, 0x6d, 0x2b, 0xed, 0xf8, 0x3b, 0x34, 0x1f,
+  0x46, 0xe0, 0xdc, 0x93, 0xcd, 0xda, 0x56, 0x0c, 0x58, 0x6b, 0x4a, 0xe4, 0xbd, 0x79, 0xb9, 0x68,
+  0xae, 0xf5, 0xcc, 0x9c, 0xbb, 0x0d, 0xa9, 0x62, 0x11, 0xf8, 0xf5, 0x56, 0x05, 0xd4, 0x4e, 0x4f,
+  0x0e, 0x2f, 0x5a, 0x6b, 0x6d, 0xe7, 0x68, 0x93, 0xc8, 0x01, 0x6d, 0xb4, 0x78, 0xae, 0xcb, 0x83,
+  0x4c, 0xad, 0x64, 0xbf, 0x47, 0x55, 0xb9, 0x49, 0x74, 0x14, 0x83, 0xe1, 0xce, 0x92, 0xde, 0x5e,
+  0xb5, 0xca, 0x5e, 0x71, 0x20, 0x19, 0xc2, 0xc2, 0xb9, 0xf0, 0x92, 0x09, 0x73, 0xd2, 0xdd, 0x3d,
+  0x36, 0x81, 0xe5, 0x74, 0xf3, 0xe6, 0x59, 0x07, 0x68, 0xa6, 0x20, 0xa8, 0xb4, 0x8d, 0xb2, 0xb1,
+  0x85, 0x1d, 0xc6, 0x21, 0xf4, 0x32, 0x88, 0xc2, 0x45, 0x0c, 0xd9, 0xc1, 0x24, 0xf4, 0xd1, 0xa6,
+  0xb0, 0x5f, 0x87, 0xb6, 0xc2, 0xc4, 0xfe, 0x1e, 0xee, 0x87, 0x41, 0x0d, 0x10, 0x8c, 0xbc, 0x68,
+  0xba, 0x80, 0xbe, 0x58, 0xc4, 0xfd, 0xd0, 0x71, 0x63, 0xb9, 0xdb, 0x55, 0xd9, 0xbb, 0x71, 0x22,
+  0xf6, 0xe5, 0xc5, 0xe9, 0xbb, 0xd3, 0xd7, 0x4f, 0x9f, 0x9d, 0x77, 0xb5, 0xc3, 0x26, 0x1f, 0xd4,
+  0x9b, 0x23, 0x4b, 0xeb, 0xec, 0x8d, 0xe6, 0xc1, 0x10, 0xa7, 0xcc, 0x7e, 0x5c, 0xf2, 0x5c, 0xfd,
+  0x2e, 0xe2, 0xc9, 0x3c, 0x0a, 0x98, 0x1b, 0x0e, 0xe7, 0xb8, 0xca, 0x55, 0xc6, 0x3c, 0xb9, 0xf0,
+  0x39, 0x7e, 0x3d, 0x5d, 0x3e, 0x75, 0x91, 0x04, 0xa6, 0x9e, 0xb5, 0x89, 0x79, 0x72, 0x0d, 0xc8,
+  0x41, 0xb1, 0x81, 0x08, 0xea, 0x77, 0x38, 0x0e, 0xef, 0x52, 0x57, 0x1d, 0x6f, 0x54, 0xe2, 0x3a,
+  0xaf, 0x60, 0xc5, 0x99, 0xdc, 0xe4, 0xc4, 0xef, 0xd0, 0x1e, 0xe6, 0x75, 0x05, 0xc1, 0x12, 0x4c,
+  0x25, 0x4e, 0xb7, 0xe0, 0xda, 0xcc, 0x99, 0xcd, 0x7c, 0x6f, 0x85, 0x9c, 0x6d, 0xd6, 0x0d, 0xdc,
+  0xb5, 0x0b, 0x56, 0x5b, 0x77, 0x11, 0x3a, 0x4b, 0x9c, 0x95, 0x8a, 0x51, 0xc6, 0xcb, 0x38, 0x2c,
+  0xcd, 0x23, 0x1f, 0x82, 0x07, 0xda, 0x27, 0xc4, 0xef, 0xc6, 0x9d, 0xd8, 0x22, 0x8b, 0xdb, 0x77,
+  0xda, 0xdf, 0x95, 0x5f, 0xf1, 0x5f, 0xcd, 0x79, 0x0c, 0x7e, 0xb7, 0xfc, 0x25, 0x8c, 0xa0, 0xb5,
+  0x35, 0xa2, 0xd3, 0x3e, 0x7e, 0xd4, 0xc1, 0x39, 0xc2, 0x38, 0x25, 0x44, 0xec, 0x8c, 0x3a, 0xd5,
+  0x71, 0x25, 0xc1, 0x4e, 0xd2, 0xce, 0x61, 0x22, 0xa0, 0x30, 0x01, 0x78, 0x62, 0x5e, 0xf1, 0xc3,
+  0x71, 0x49, 0x93, 0xec, 0xb3, 0x91, 0xe3, 0xf9, 0xdc, 0x6d, 0x6b, 0x06, 0x78, 0xbc, 0x8f, 0x7a,
+  0x67, 0x4f, 0xc1, 0x06, 0x53, 0x2d, 0x27, 0x39, 0x07, 0x4f, 0x5f, 0x72, 0x21, 0x76, 0x80, 0xa4,
+  0x2e, 0x99, 0x18, 0x4b, 0xb0, 0x29, 0x63, 0x34, 0x05, 0xa4, 0x48, 0x24, 0x6e, 0x17, 0xeb, 0x8e,
+  0x2c, 0xf3, 0x58, 0x33, 0x81, 0x23, 0x4d, 0xdf, 0x27, 0xd2, 0x6e, 0x89, 0xa8, 0xd5, 0x72, 0xd9,
+  0xdc, 0xee, 0x96, 0x34, 0x6d, 0x1f, 0x7b, 0xd1, 0x2b, 0xb1, 0xef, 0x0d, 0x79, 0xa9, 0x6c, 0xeb,
+  0xc6, 0xb2, 0xde, 0xc5, 0xa2, 0xce, 0x1e, 0x40, 0x0e, 0x9d, 0x77, 0xbb, 0x5d, 0x53, 0x4f, 0x05,
+  0xb9, 0xaf, 0x55, 0xb5, 0xfd, 0x29, 0xfd, 0x5d, 0xda, 0x0a, 0x85, 0x95, 0x52, 0x88, 0x3a, 0x77,
+  0x9d, 0xc2, 0x4e, 0x29, 0x96, 0xf5, 0x7d, 0xad, 0x4c, 0x9d, 0xc0, 0x5f, 0x57, 0xa1, 0xa8, 0x29,
+  0xa3, 0x54, 0x88, 0x00, 0xfe, 0x2e, 0xeb, 0x0a, 0x45, 0x5d, 0x19, 0xa5, 0x42, 0xa3, 0x48, 0x8a,
+  0x7b, 0xd8, 0x53, 0x75, 0x6b, 0x12, 0x2e, 0xae, 0x21, 0xfa, 0x2a, 0xb9, 0x12, 0xac, 0x49, 0xd7,
+  0xad, 0x4c, 0x20, 0x4f, 0x8e, 0x3b, 0xf4, 0x13, 0x3c, 0xc8, 0xb4, 0xab, 0x69, 0x34, 0xd8, 0x03,
+  0xb7, 0x32, 0x8f, 0xb9, 0x5d, 0xc7, 0x6a, 0xa0, 0xa6, 0xaa, 0xd2, 0xa4, 0xd7, 0xb5, 0x6c, 0xfd,
+  0x58, 0x63, 0x97, 0xcf, 0x01, 0x43, 0x76, 0xf2, 0x1c, 0x68, 0x27, 0x50, 0xfc, 0x13, 0x28, 0xfd,
+  0xfa, 0x6b, 0x8b, 0x46, 0x4b, 0x15, 0x58, 0xa3, 0x50, 0x52, 0x33, 0x4a, 0x4a, 0x47, 0x8f, 0x1e,
+  0xe5, 0x24, 0x30, 0xd9, 0x87, 0xcf, 0x7d, 0x20, 0x98, 0x7a, 0xc1, 0x3c, 0xe1, 0x71, 0x4e, 0x6a,
+  0x69, 0x61, 0x4a, 0x13, 0x83, 0x2b, 0x09, 0xdc, 0x02, 0x8d, 0x2c, 0xdc, 0x47, 0xf6, 0x40, 0x57,
+  0xb2, 0xb1, 0x31, 0x3a, 0xd5, 0x0c, 0x55, 0x5f, 0x2a, 0xa8, 0x06, 0xd0, 0x29, 0x09, 0xdd, 0xad,
+  0x90, 0xd6, 0xb8, 0x14, 0xc5, 0xf6, 0x89, 0x4a, 0xcf, 0xab, 0xda, 0x7c, 0x86, 0x55, 0x04, 0x56,
+  0xa6, 0xff, 0x5a, 0xb6, 0x29, 0xae, 0xa5, 0x0a, 0x9e, 0x69, 0x73, 0x94, 0xd9, 0x79, 0x54, 0xf9,
+  0x65, 0x0c, 0x05, 0xa8, 0xbc, 0x92, 0x28, 0x85, 0xfd, 0xd3, 0x36, 0xf0, 0x9a, 0x46, 0xdd, 0x60,
+  0x02, 0x60, 0xde, 0x65, 0xf8, 0x67, 0x65, 0xe3, 0xa5, 0xe2, 0x96, 0xbd, 0x4e, 0x04, 0x24, 0xc6,
+  0x67, 0x17, 0xe7, 0xef, 0xce, 0x5e, 0x3e, 0x7b, 0xf9, 0xea, 0xaa, 0xfb, 0xc6, 0xbc, 0xed, 0xb7,
+  0x4c, 0x58, 0xe8, 0x6f, 0xcd, 0x83, 0x0b, 0xfa, 0x30, 0xad, 0x3e, 0x7c, 0xf4, 0xfb, 0xe2, 0xd7,
+  0x41, 0x9f, 0x7e, 0xb5, 0x64, 0xa1, 0xf8, 0x75, 0x6e, 0x9b, 0x6f, 0x85, 0x42, 0x5c, 0xbd, 0x7e,
+  0xf5, 0xea, 0xe5, 0xeb, 0x17, 0xb9, 0xee, 0x04, 0xd1, 0x59, 0xd3, 0x82, 0x40, 0xe8, 0xf6, 0xe0,
+  0xf4, 0x42, 0x74, 0x70, 0xcf, 0x18, 0xb2, 0x9f, 0xeb, 0x5f, 0xbc, 0xfb, 0x02, 0x3a, 0xba, 0x84,
+  0x1e, 0xf6, 0xde, 0x68, 0x27, 0x10, 0x2c, 0x44, 0x10, 0x44, 0x38, 0xec, 0x11, 0x7b, 0x39, 0xe4,
+  0x4e, 0xe0, 0x39, 0x1a, 0x04, 0x23, 0x96, 0xf5, 0xd6, 0x78, 0xa3, 0xbd, 0x08, 0x23, 0x70, 0x56,
+  0x27, 0x53, 0x88, 0xdf, 0x86, 0x50, 0x6c, 0xd9, 0x86, 0x6d, 0x63, 0xf9, 0x55, 0x38, 0x57, 0xcb,
+  0xed, 0x9a, 0x61, 0xb7, 0xde, 0x1a, 0xd0, 0xdb, 0x97, 0xe8, 0x81, 0x00, 0xf7, 0x8b, 0x79, 0x14,
+  0xce, 0x40, 0xe8, 0xf6, 0xa1, 0x51, 0x3b, 0xcc, 0x7a, 0x52, 0x6b, 0xea, 0xa6, 0x51, 0xaf, 0x61,
+  0xcd, 0x19, 0x38, 0x4e, 0x60, 0x00, 0x86, 0xbf, 0x70, 0xf2, 0x8d, 0xeb, 0x75, 0xa3, 0x61, 0x51,
+  0xb7, 0xcf, 0x61, 0x85, 0xf2, 0x39, 0x11, 0x68, 0x46, 0xc3, 0x36, 0x1a, 0x4d, 0x85, 0x8b, 0x18,
+  0x39, 0x6e, 0x1c, 0x18, 0xcd, 0x5a, 0x56, 0xc8, 0x81, 0x50, 0x56, 0x34, 0xeb, 0xc6, 0x81, 0x89,
+  0x15, 0x17, 0xab, 0xb2, 0x03, 0xcb, 0x38, 0x68, 0x52, 0xc7, 0xe9, 0xe0, 0xb2, 0xfc, 0xc0, 0x38,
+  0x20, 0x6e, 0xcf, 0x9c, 0xf9, 0xd0, 0x89, 0xe7, 0xb1, 0x06, 0x29, 0x96, 0xd1, 0xa2, 0x29, 0x9f,
+  0x8c, 0xc4, 0x5c, 0x5b, 0x35, 0xa3, 0xd5, 0x7c, 0xbb, 0x27, 0xb1, 0x14, 0xe2, 0xee, 0x06, 0x73,
+  0xdf, 0x57, 0x96, 0x1a, 0xcc, 0xe7, 0x9e, 0x85, 0xe1, 0xfb, 0xd2, 0x10, 0xd4, 0x15, 0xcc, 0x77,
+  0xd8, 0xeb, 0xd6, 0x52, 0x8f, 0xf5, 0x46, 0xfb, 0xdf, 0x3f, 0xfe, 0xee, 0x3f, 0x35, 0x43, 0x7b,
+  0xd8, 0xef, 0x43, 0xc8, 0x5b, 0xd7, 0xde, 0x76, 0x24, 0x89, 0xdd, 0xc8, 0x48, 0xfe, 0xf2, 0x2f,
+  0xbf, 0xfe, 0x9f, 0xff, 0xfe, 0x8d, 0x20, 0x3a, 0xad, 0xd5, 0x0f, 0x14, 0x22, 0xb5, 0x9f, 0x7f,
+  0xfa, 0x8f, 0x8c, 0xea, 0x1c, 0x32, 0xf4, 0x15, 0x95, 0xa5, 0x74, 0xf5, 0xaf, 0xff, 0x88, 0x14,
+  0xad, 0x83, 0xb3, 0x8b, 0x8b, 0x53, 0x85, 0xc2, 0x54, 0x06, 0xfb, 0x7b, 0xd9, 0xcd, 0xa9, 0x79,
+  0x56, 0x3f, 0xbf, 0x58, 0x11, 0x35, 0xd4, 0xb1, 0xfe, 0x24, 0x89, 0xea, 0xcd, 0x96, 0x7d, 0x4a,
+  0x6c, 0x67, 0x1d, 0xfc, 0xe1, 0x1f, 0x64, 0x9d, 0x69, 0x9e, 0x5d, 0x9c, 0x5b, 0x58, 0xa7, 0x58,
+  0xef, 0x64, 0x3e, 0xf5, 0x20, 0x32, 0x59, 0x12, 0x22, 0x13, 0x81, 0x08, 0xf8, 0xae, 0x03, 0x75,
+  0x26, 0xbf, 0xfd, 0x2f, 0x6c, 0x6e, 0x5d, 0x1c, 0x9a, 0xfd, 0xbe, 0x1c, 0x7f, 0x72, 0x94, 0x07,
+  0xed, 0x37, 0xff, 0x26, 0x07, 0x39, 0xbf, 0x38, 0x6d, 0xb5, 0x0e, 0x54, 0x06, 0xa0, 0xfd, 0x9f,
+  0x88, 0x35, 0x0a, 0x94, 0x0a, 0xc3, 0x83, 0x1b, 0xba, 0x08, 0x6e, 0x70, 0x09, 0xf7, 0x81, 0x01,
+  0xb9, 0x8e, 0xef, 0xad, 0x56, 0xf6, 0x7d, 0xed, 0x29, 0x48, 0x51, 0xa3, 0xda, 0x37, 0xe6, 0x5b,
+  0x5d, 0x08, 0xf6, 0x86, 0x16, 0xf9, 0x7d, 0xed, 0xe7, 0xb8, 0x0f, 0xaa, 0x61, 0xe1, 0xfa, 0x42,
+  0x0f, 0x65, 0x14, 0x22, 0x55, 0x28, 0xd6, 0xea, 0x52, 0x07, 0xd6, 0xdb, 0x55, 0x31, 0x12, 0x5d,
+  0x51, 0xc4, 0xdf, 0xd5, 0xb2, 0xd3, 0x09, 0x6d, 0x5f, 0xd2, 0xed, 0x6b, 0x20, 0xfc, 0x22, 0xa7,
+  0x57, 0x90, 0x0a, 0xf1, 0x08, 0x99, 0xa5, 0x0d, 0x58, 0x60, 0x94, 0x62, 0x8d, 0x0a, 0xfd, 0xea,
+  0xd2, 0xdf, 0x4e, 0x8e, 0x77, 0xc1, 0x9f, 0xa4, 0xce, 0xf5, 0x86, 0xf1, 0xc6, 0x52, 0xac, 0xf7,
+  0xa4, 0x87, 0x52, 0x55, 0x87, 0x42, 0xb8, 0x15, 0x8a, 0xd1, 0x1e, 0x74, 0xbb, 0x59, 0xd4, 0xf4,
+  0xe8, 0xd1, 0x83, 0x98, 0xc7, 0x31, 0x34, 0xbd, 0x82, 0x98, 0x1a, 0xe2, 0x11, 0x8c, 0x8d, 0x9e,
+  0x82, 0x2a, 0x97, 0x34, 0x11, 0x6d, 0x71, 0x57, 0xd3, 0x09, 0xb9, 0x1c, 0x51, 0xbc, 0x46, 0x64,
+  0x68, 0x16, 0x02, 0x96, 0xba, 0x69, 0xcd, 0xb8, 0xa3, 0x68, 0xae, 0x2d, 0x29, 0xb4, 0x8f, 0x7a,
+  0xc1, 0x5d, 0xeb, 0x77, 0xb0, 0x38, 0x51, 0x5c, 0x5a, 0x11, 0x24, 0x25, 0xe1, 0x69, 0x85, 0x78,
+  0xc5, 0x32, 0x96, 0x1b, 0x33, 0xe2, 0x53, 0x88, 0x71, 0x8b, 0xbc, 0x11, 0x30, 0xe2, 0xf0, 0xf7,
+  0x0a, 0x82, 0x70, 0x98, 0xe3, 0x94, 0x7e, 0x7c, 0x49, 0x67, 0xcd, 0xe9, 0xaf, 0x27, 0x14, 0x71,
+  0x03, 0xf1, 0x8f, 0x4b, 0x9a, 0xb2, 0xdd, 0xa1, 0xe9, 0x15, 0x08, 0xda, 0xe3, 0xf8, 0x05, 0x1e,
+  0x5f, 0x0f, 0x61, 0x56, 0xb0, 0x10, 0x44, 0x27, 0x37, 0xe0, 0xfb, 0x9d, 0x81, 0xcf, 0x8f, 0x73,
+  0xa4, 0x6d, 0xf5, 0x17, 0x13, 0xd1, 0xb3, 0x26, 0x61, 0x2d, 0x34, 0x94, 0x4b, 0x7b, 0x02, 0x5d,
+  0xc2, 0xba, 0xdb, 0x77, 0x26, 0x90, 0x0d, 0x43, 0xcc, 0x9f, 0x1c, 0x03, 0x9f, 0x93, 0xca, 0x08,
+  0x54, 0x21, 0x82, 0x46, 0xe8, 0x2f, 0x38, 0x44, 0xe6, 0xf3, 0x88, 0x3f, 0x3e, 0xac, 0x36, 0xf6,
+  0x6b, 0xb6, 0xde, 0xce, 0x95, 0xd2, 0xd4, 0x50, 0x8b, 0x35, 0x2c, 0xd4, 0x8c, 0x95, 0x83, 0x51,
+  0xa9, 0x74, 0x23, 0xd9, 0x2f, 0x15, 0x07, 0xd2, 0xbe, 0xfd, 0xa6, 0x0f, 0x1c, 0x7f, 0xfb, 0xcd,
+  0x99, 0xa6, 0xeb, 0xab, 0x7e, 0x52, 0xa3, 0xd4, 0x8c, 0x9c, 0x79, 0x0e, 0x2b, 0xe9, 0x4f, 0xdd,
+  0x58, 0x7d, 0xdf, 0xd7, 0x7e, 0xa2, 0x09, 0xc4, 0x66, 0x11, 0x48, 0x02, 0x86, 0x42, 0xec, 0x0b,
+  0x90, 0x41, 0x0a, 0x70, 0x29, 0x6b, 0x09, 0x2e, 0xca, 0x49, 0x05, 0x56, 0xf4, 0xb5, 0x00, 0x94,
+  0x42, 0xae, 0xa7, 0x4c, 0xa5, 0xbd, 0x6b, 0x06, 0x79, 0x9c, 0x7f, 0x46, 0x9b, 0x3e, 0xac, 0x1d,
+  0x98, 0xe7, 0xe0, 0xb8, 0x0c, 0x88, 0x0b, 0x87, 0x95, 0x94, 0x42, 0xcf, 0x05, 0x37, 0x64, 0x6e,
+  0xc8, 0x86, 0x06, 0x4c, 0xcb, 0x34, 0xe6, 0x0a, 0xcb, 0x30, 0x52, 0x3c, 0xd6, 0xce, 0xf9, 0xc8,
+  0x99, 0xfb, 0x09, 0x2b, 0x9d, 0x62, 0x10, 0x14, 0xeb, 0xc0, 0xd4, 0x2b, 0x0e, 0x4b, 0x1e, 0x64,
+  0xc9, 0x43, 0x56, 0x82, 0x05, 0x1a, 0x8a, 0xd4, 0x78, 0x25, 0x0a, 0x13, 0xd2, 0xc6, 0x42, 0x8f,
+  0xaf, 0x64, 0x31, 0x06, 0x97, 0xc7, 0xb8, 0xa0, 0x4d, 0x1d, 0x1f, 0xba, 0xea, 0xfb, 0xe2, 0x4e,
+  0x81, 0xd5, 0x32, 0xbf, 0xfd, 0x46, 0x93, 0xee, 0x03, 0x22, 0x86, 0xee, 0x6a, 0xe5, 0xaf, 0xd0,
+  0xf5, 0x82, 0x97, 0x38, 0x6d, 0xa8, 0x38, 0x43, 0x6f, 0x21, 0xe0, 0x84, 0x5f, 0xe4, 0x3b, 0xb4,
+  0xd4, 0xc2, 0xa1, 0xe0, 0xc8, 0x3c, 0x36, 0xdb, 0xf0, 0x29, 0x3a, 0x82, 0xc9, 0xa2, 0x3a, 0xce,
+  0x23, 0xda, 0x9d, 0xa0, 0xa6, 0x30, 0xfe, 0xaa, 0x9f, 0xe3, 0x83, 0x76, 0x21, 0x2e, 0x50, 0x06,
+  0xcb, 0x35, 0x13, 0x23, 0xa6, 0x45, 0xf9, 0x61, 0xa1, 0x94, 0x86, 0x85, 0x4f, 0xc2, 0x41, 0xba,
+  0x21, 0xe4, 0x0f, 0x4d, 0x09, 0x41, 0x90, 0x5f, 0xf5, 0xb5, 0x7a, 0xb1, 0x1d, 0x9c, 0x92, 0x88,
+  0x5f, 0x79, 0xaa, 0x69, 0xe8, 0xf2, 0x2b, 0x48, 0x7b, 0x86, 0x93, 0xa7, 0xb8, 0x11, 0x01, 0x43,
+  0x22, 0xf5, 0x7a, 0xa9, 0x2a, 0x83, 0xe4, 0x43, 0x8a, 0x7e, 0x7a, 0xef, 0x01, 0x7f, 0x8b, 0x39,
+  0x24, 0x1f, 0x32, 0xc6, 0x57, 0xd5, 0x6a, 0x5b, 0x28, 0x12, 0x71, 0x64, 0xda, 0x47, 0x16, 0xf3,
+  0x1e, 0x6b, 0x76, 0xbd, 0xfc, 0x04, 0xbe, 0x80, 0xe0, 0x2c, 0x5b, 0x7c, 0x53, 0x87, 0xf5, 0x21,
+  0xa1, 0x02, 0xfe, 0x7f, 0xc1, 0xa3, 0x30, 0x6d, 0xab, 0x14, 0x1d, 0x6b, 0x2f, 0x5f, 0xb0, 0x92,
+  0x69, 0xb5, 0xed, 0x1a, 0x2a, 0xd1, 0xcb, 0x7e, 0x9f, 0x95, 0xc4, 0x0f, 0xc1, 0x18, 0xc6, 0x8b,
+  0x22, 0xcc, 0x55, 0x18, 0x5c, 0x45, 0xb5, 0x44, 0x33, 0xf2, 0x39, 0x4f, 0x22, 0x08, 0x32, 0x15,
+  0x12, 0x2a, 0x7b, 0x05, 0x65, 0x0a, 0x27, 0x54, 0x26, 0x76, 0x57, 0x53, 0x4e, 0x94, 0x22, 0xe4,
+  0x44, 0x70, 0x90, 0x63, 0x9f, 0x28, 0xae, 0x68, 0x57, 0x3d, 0x6b, 0x80, 0xfd, 0x62, 0xb6, 0x73,
+  0x5c, 0x92, 0x05, 0xcf, 0x28, 0x69, 0x3c, 0xd6, 0xfa, 0xa1, 0xef, 0x87, 0x0b, 0xcc, 0xf2, 0x7c,
+  0x2a, 0x81, 0xfe, 0x5e, 0x84, 0xf2, 0x3b, 0x2b, 0xb3, 0x79, 0x8c, 0x55, 0x2f, 0xae, 0x2f, 0x35,
+  0x1d, 0xe3, 0x7b, 0x62, 0x3e, 0x40, 0xdf, 0x09, 0x5e, 0x74, 0x3c, 0xe6, 0x91, 0xc2, 0x3f, 0x15,
+  0x5f, 0x8b, 0xe2, 0x15, 0x5d, 0x9c, 0x38, 0x51, 0x52, 0xa4, 0xba, 0xc2, 0xc2, 0x15, 0x0d, 0x0f,
+  0xdc, 0x22, 0xc5, 0x45, 0xe0, 0xe6, 0xb4, 0x87, 0x0a, 0x4f, 0x23, 0xfc, 0x1b, 0x80, 0xf1, 0xe3,
+  0xbc, 0x0a, 0x45, 0x2a, 0x02, 0xe9, 0x20, 0x12, 0x01, 0xfa, 0x79, 0x02, 0xcb, 0xcc, 0x0d, 0x38,
+  0x25, 0xf1, 0xa9, 0x65, 0xb3, 0x11, 0xbe, 0xba, 0x8f, 0xe6, 0xf0, 0x29, 0xf7, 0x0f, 0x8d, 0x32,
+  0xf7, 0x95, 0xb5, 0x7c, 0xee, 0xc5, 0x88, 0xd1, 0xa7, 0xda, 0xca, 0x86, 0x6d, 0xcc, 0xe5, 0x56,
+  0x2e, 0x8b, 0xa8, 0xae, 0x97, 0x33, 0x92, 0xec, 0xea, 0x97, 0xbe, 0x46, 0x73, 0xce, 0x13, 0xe8,
+  0x0a, 0x5c, 0x21, 0x2b, 0xa1, 0x07, 0x54, 0x0b, 0xf7, 0xb5, 0xbc, 0xe3, 0xf2, 0x66, 0xd8, 0x99,
+  0x37, 0x53, 0xcb, 0xe6, 0x33, 0xca, 0x91, 0xd0, 0x08, 0xe8, 0xdb, 0xbe, 0x16, 0xe7, 0xda, 0x40,
+  0xac, 0x4c, 0xad, 0x46, 0x11, 0xe7, 0x4f, 0xe0, 0xfb, 0xbe, 0xc6, 0x06, 0x4b, 0xc8, 0xf4, 0xb4,
+  0x7c, 0x34, 0xb1, 0xda, 0x3c, 0x28, 0xa6, 0x60, 0x22, 0xae, 0xf8, 0x6e, 0x49, 0x98, 0x12, 0x9b,
+  0x7c, 0x3a, 0x0f, 0x13, 0x74, 0xc4, 0xc1, 0xb6, 0xfd, 0x08, 0xac, 0xbf, 0x4e, 0xef, 0x48, 0x6d,
+  0xca, 0x13, 0xa9, 0xe2, 0xbb, 0xf1, 0x99, 0x11, 0xe1, 0xad, 0xb6, 0x58, 0x2e, 0xe6, 0x31, 0xf7,
+  0xbb, 0xd2, 0x0b, 0x41, 0x94, 0x03, 0x0b, 0x38, 0x16, 0x8e, 0xbb, 0x66, 0x67, 0x7c, 0x94, 0xa5,
+  0x56, 0xe0, 0x35, 0x82, 0x71, 0x32, 0xe9, 0x8c, 0xf7, 0xf7, 0x65, 0xab, 0x71, 0x34, 0xeb, 0x66,
+  0xbb, 0x4e, 0xc3, 0x88, 0x83, 0x57, 0x90, 0x1b, 0x4f, 0x25, 0x2d, 0x9c, 0x25, 0xb8, 0xfb, 0x3c,
+  0xc3, 0x0e, 0x81, 0xae, 0x42, 0xfb, 0xd8, 0xdd, 0xac, 0xb3, 0x37, 0xe3, 0xb7, 0x6f, 0x30, 0x79,
+  0x4b, 0xc7, 0xf2, 0xf2, 0x55, 0x10, 0x72, 0x7a, 0x47, 0xf9, 0x22, 0xfb, 0xed, 0xa3, 0x47, 0xde,
+  0x11, 0x31, 0x9d, 0x72, 0xe2, 0x11, 0x27, 0xd8, 0x3b, 0x80, 0x0f, 0x66, 0x77, 0x36, 0x81, 0xf8,
+  0xaf, 0x14, 0xf0, 0x05, 0x7b, 0x39, 0x5b, 0x4d, 0xf1, 0x8d, 0xf7, 0xd6, 0xf0, 0x74, 0xb9, 0xba,
+  0xfa, 0x39, 0x52, 0x68, 0x4a, 0xe5, 0xb8, 0x7a, 0x0b, 0xc9, 0x21, 0x85, 0x34, 0x5d, 0x2a, 0x50,
+  0x7c, 0xf1, 0xc7, 0x4f, 0x8b, 0x35, 0x95, 0x15, 0xc3, 0x85, 0x78, 0x4b, 0x96, 0xbd, 0xe1, 0xb4,
+  0xa9, 0xcc, 0xc4, 0xd9, 0x03, 0xcb, 0xce, 0x16, 0x58, 0x3a, 0x4c, 0xbc, 0xca, 0xbc, 0xb3, 0x23,
+  0x0a, 0x03, 0xbf, 0x25, 0xb7, 0x86, 0x5c, 0xc2, 0xba, 0x87, 0xc6, 0xd8, 0x99, 0xd1, 0xb7, 0xba,
+  0x92, 0xb4, 0x45, 0xe3, 0x41, 0xa3, 0xd9, 0xb8, 0x0e, 0x9f, 0xf0, 0x5b, 0x8c, 0x97, 0xb1, 0x87,
+  0xa8, 0x5b, 0x82, 0x34, 0xa8, 0x67, 0x59, 0xfa, 0x23, 0xf3, 0xd6, 0xea, 0xeb, 0x8f, 0x5b, 0xc6,
+  0x58, 0x14, 0x35, 0xb0, 0xa4, 0x06, 0x25, 0x75, 0x63, 0xd0, 0x2d, 0x0d, 0xd3, 0xea, 0x8e, 0xd0,
+  0x24, 0x0d, 0xfa, 0x02, 0x63, 0x8d, 0xf6, 0xc1, 0x6a, 0xf7, 0xc7, 0xf4, 0x77, 0x80, 0xb6, 0xaa,
+  0x6e, 0x2d, 0xba, 0xde, 0x94, 0x96, 0xe5, 0x52, 0x64, 0x8c, 0x8d, 0x81, 0x31, 0x4a, 0xb5, 0x50,
+  0xb6, 0x55, 0xe2, 0xc3, 0xa8, 0x3a, 0xd2, 0xa9, 0x0f, 0xa5, 0x6c, 0xbc, 0xa1, 0x6c, 0x40, 0x65,
+  0xf9, 0x51, 0xf0, 0x82, 0xa5, 0x00, 0x01, 0x2d, 0x22, 0x43, 0x84, 0xf4, 0x37, 0xfd, 0x81, 0x5a,
+  0x87, 0x7b, 0x4c, 0x59, 0x81, 0x9e, 0x06, 0xde, 0x02, 0xb7, 0x6e, 0x56, 0x81, 0x19, 0x01, 0x65,
+  0x40, 0xe8, 0x38, 0x6c, 0x0a, 0xb9, 0x57, 0x75, 0xe2, 0x7e, 0xe7, 0x28, 0x02, 0x35, 0xfa, 0xf2,
+  0xb1, 0x84, 0x5a, 0xad, 0x17, 0x5b, 0xdd, 0x82, 0xe0, 0x49, 0x4a, 0xb0, 0x5f, 0x12, 0xbf, 0xab,
+  0xad, 0xb2, 0xa5, 0x3f, 0x96, 0x62, 0x49, 0x07, 0xae, 0x8c, 0x3c, 0xdf, 0x17, 0x71, 0x1c, 0xa6,
+  0x96, 0xa6, 0xd6, 0x51, 0xca, 0x5f, 0xf1, 0x61, 0x42, 0x07, 0x27, 0x05, 0x0e, 0x8c, 0xe2, 0x88,
+  0x79, 0x2f, 0xe1, 0x46, 0xce, 0x02, 0x02, 0xb3, 0xd2, 0xad, 0xb1, 0x34, 0x7c, 0x2f, 0x31, 0x28,
+  0x74, 0x34, 0xd2, 0x68, 0xca, 0xc8, 0x47, 0x4c, 0xd2, 0x72, 0x9d, 0x59, 0xb7, 0xb4, 0xec, 0xf5,
+  0x6a, 0x0a, 0x83, 0xe4, 0x07, 0x6e, 0xbb, 0xb7, 0xe9, 0x3c, 0x8c, 0x78, 0xd9, 0x5d, 0x66, 0x93,
+  0x02, 0x32, 0x41, 0x12, 0x06, 0xd0, 0x51, 0x57, 0xd5, 0x2c, 0x25, 0xfe, 0x93, 0xe1, 0x5d, 0x91,
+  0xa2, 0x18, 0xb4, 0x81, 0x68, 0xe2, 0x34, 0x96, 0x95, 0x32, 0xcc, 0x41, 0x03, 0xb3, 0x38, 0xa6,
+  0x71, 0xda, 0x12, 0xa4, 0xbd, 0x22, 0x4a, 0xf1, 0x2d, 0xb0, 0x97, 0x6a, 0xbf, 0xb1, 0x0a, 0xe4,
+  0x3e, 0x72, 0x3f, 0xe6, 0x77, 0x3b, 0x83, 0x7d, 0x5f, 0x37, 0xc0, 0x20, 0xf0, 0xb0, 0x89, 0x35,
+  0x31, 0xbb, 0x8c, 0xa1, 0x01, 0x1f, 0x7b, 0xc1, 0x25, 0x28, 0x2c, 0xb8, 0x58, 0x59, 0xe4, 0x44,
+  0x43, 0xe8, 0x77, 0x5f, 0x76, 0x56, 0xb5, 0x61, 0x04, 0xe5, 0x47, 0xf6, 0xad, 0x6c, 0x81, 0xa0,
+  0x49, 0xd5, 0x2f, 0x9f, 0x3e, 0xb6, 0x75, 0x95, 0xb5, 0x92, 0xbe, 0x41, 0x5d, 0x08, 0x8f, 0xcf,
+  0x31, 0xae, 0xbd, 0x75, 0xdc, 0xfb, 0x01, 0x84, 0x64, 0x20, 0x27, 0x8b, 0x1f, 0x8e, 0x85, 0x8f,
+  0x1f, 0x49, 0x91, 0xc8, 0x8c, 0xae, 0xf8, 0xaf, 0xba, 0x00, 0x95, 0xb0, 0xc1, 0x6e, 0xcd, 0x16,
+  0xdf, 0x9e, 0x74, 0xad, 0xa6, 0xf8, 0x26, 0xb8, 0x33, 0xc5, 0x8f, 0x67, 0x90, 0xa2, 0xc8, 0xaf,
+  0x57, 0x90, 0x64, 0xa4, 0x5f, 0x87, 0x51, 0xf7, 0x0d, 0xac, 0x35, 0xe0, 0x7d, 0xe5, 0x3d, 0x6a,
+  0x3c, 0xd0, 0xc2, 0x33, 0x1c, 0x1e, 0xaf, 0xdd, 0x4c, 0xa6, 0x7b, 0xce, 0x78, 0x7c, 0x21, 0x33,
+  0xa4, 0xca, 0xc0, 0x0b, 0x98, 0x38, 0x93, 0xe8, 0x80, 0x6f, 0xa6, 0x96, 0x58, 0x2d, 0x8e, 0xad,
+  0xc1, 0x1a, 0xe4, 0x69, 0x48, 0x6e, 0xcb, 0x43, 0xc9, 0xd8, 0x17, 0x86, 0xdc, 0x1e, 0x5a, 0x80,
+  0xb2, 0x8b, 0x59, 0x3c, 0x7a, 0x34, 0x49, 0xbf, 0x3f, 0xc9, 0xfc, 0x92, 0x9c, 0xe0, 0xa2, 0x23,
+  0xe7, 0x37, 0x51, 0xe2, 0x99, 0x69, 0xd6, 0x9d, 0x66, 0x2c, 0xf6, 0xb5, 0x3f, 0xff, 0x5e, 0xdb,
+  0x9f, 0xa0, 0x92, 0x2a, 0x8e, 0x70, 0xcd, 0x21, 0x9c, 0x42, 0xc0, 0x53, 0xf2, 0xa4, 0xb9, 0xdf,
+  0x76, 0xbd, 0x9f, 0x88, 0x01, 0x8c, 0x28, 0x5c, 0x74, 0x4b, 0x5e, 0x55, 0xfc, 0xd2, 0xbf, 0x36,
+  0x8d, 0x9b, 0x6e, 0x0a, 0x12, 0x2c, 0x94, 0xab, 0x05, 0x79, 0xe0, 0x25, 0xb0, 0xfc, 0xc3, 0xdf,
+  0xa3, 0x16, 0xfe, 0xc5, 0x95, 0x76, 0xe5, 0x67, 0xa0, 0x93, 0xc7, 0xad, 0x7d, 0x28, 0x36, 0x4a,
+  0x37, 0x8f, 0x4a, 0xd6, 0xd1, 0x11, 0x7c, 0xd5, 0xf5, 0x07, 0xdd, 0x0c, 0x71, 0xf2, 0x40, 0xa9,
+  0x48, 0x32, 0x81, 0xe8, 0x74, 0xdb, 0x22, 0xc7, 0x66, 0x1f, 0xab, 0x4a, 0x02, 0xa1, 0x07, 0x42,
+  0x0f, 0xf4, 0xfc, 0xbc, 0x94, 0x8a, 0x0c, 0xab, 0x2c, 0x68, 0x30, 0x21, 0x4c, 0x48, 0xd9, 0x57,
+  0xa3, 0x02, 0x05, 0x81, 0x0d, 0xbb, 0xee, 0x72, 0xe9, 0x2d, 0x06, 0x54, 0x8a, 0xc4, 0x8f, 0x21,
+  0x08, 0x1e, 0x82, 0xd2, 0xef, 0xa7, 0x3a, 0x98, 0x6d, 0xf8, 0x04, 0x61, 0x39, 0x4e, 0x42, 0xc8,
+  0xe7, 0x3f, 0x6e, 0x8d, 0xba, 0xc4, 0x35, 0x20, 0xcc, 0x51, 0x4c, 0xf3, 0x38, 0x02, 0xc3, 0x88,
+  0x9c, 0xe5, 0xe9, 0x7c, 0x34, 0x82, 0xe8, 0x5f, 0x6f, 0xd3, 0xd6, 0xea, 0x7a, 0xfb, 0x81, 0x84,
+  0x61, 0x90, 0x4d, 0x54, 0xec, 0xda, 0x61, 0x40, 0x73, 0xee, 0x24, 0xce, 0xcf, 0x3d, 0xbe, 0x00,
+  0xa2, 0xe2, 0x9e, 0xd0, 0x0d, 0x2e, 0x61, 0xaf, 0xbd, 0x20, 0x69, 0x95, 0x2c, 0xdd, 0x50, 0x7e,
+  0xd9, 0x10, 0xf4, 0x28, 0x36, 0xa2, 0xd4, 0xd4, 0x74, 0xa9, 0x70, 0x68, 0x30, 0x59, 0xb9, 0xd5,
+  0x2c, 0xd5, 0x8d, 0x24, 0xc2, 0x4d, 0xb7, 0xcc, 0x84, 0xd4, 0xca, 0xa6, 0xac, 0xdc, 0xcb, 0x0c,
+  0x33, 0xab, 0xad, 0xd9, 0xa5, 0x56, 0xbe, 0x16, 0x6c, 0xee, 0x04, 0x27, 0x5d, 0x99, 0x45, 0x61,
+  0x12, 0x26, 0x90, 0x06, 0x88, 0xc3, 0xaf, 0x0a, 0x3e, 0x6b, 0x40, 0x31, 0x1a, 0xb1, 0x42, 0x34,
+  0xa5, 0x81, 0x61, 0x21, 0xb3, 0x7b, 0x8a, 0x46, 0xec, 0x14, 0x6f, 0xa5, 0x31, 0xd4, 0x7c, 0xcb,
+  0xb1, 0xc6, 0xe5, 0x3c, 0x9e, 0x90, 0x8d, 0x06, 0xdc, 0x6f, 0x0b, 0x9f, 0x12, 0x1b, 0x60, 0xdd,
+  0xa3, 0x51, 0x2c, 0x6c, 0x1d, 0x62, 0x36, 0x06, 0xf2, 0x81, 0x34, 0x8a, 0xe1, 0x29, 0x33, 0xbb,
+  0xba, 0xba, 0xe8, 0x40, 0x57, 0xbe, 0xcf, 0xf0, 0x0a, 0x05, 0x4b, 0x42, 0x36, 0x83, 0xac, 0x12,
+  0x03, 0x32, 0x6f, 0xc4, 0xe6, 0x81, 0x93, 0x66, 0x41, 0x24, 0x1d, 0x59, 0xd5, 0x05, 0xfa, 0x98,
+  0x2b, 0x91, 0x17, 0x25, 0x8a, 0x97, 0xa2, 0x52, 0xaa, 0xb7, 0x24, 0x4d, 0x85, 0x9b, 0xb6, 0x44,
+  0xd4, 0x48, 0xa4, 0xe9, 0x96, 0x41, 0x29, 0xa7, 0xa4, 0x46, 0xc3, 0x34, 0xf5, 0xce, 0x7a, 0x35,
+  0x86, 0x9a, 0x86, 0x65, 0x62, 0x65, 0x6e, 0xbf, 0x15, 0xc7, 0xbd, 0xa0, 0x67, 0x28, 0x52, 0xab,
+  0x82, 0x74, 0xd8, 0x0d, 0x17, 0x15, 0x2a, 0xbc, 0x0a, 0xe7, 0xd1, 0x10, 0x50, 0xcc, 0xb3, 0x27,
+  0x43, 0xbc, 0x8e, 0x70, 0xbb, 0x3c, 0x26, 0x8d, 0x53, 0xe8, 0xa5, 0x7d, 0x88, 0x47, 0x33, 0x30,
+  0x42, 0x02, 0x58, 0xcf, 0x05, 0x80, 0x3e, 0x9e, 0xee, 0x2e, 0xd1, 0x0d, 0xa2, 0x53, 0x5c, 0x80,
+  0x2c, 0x16, 0x78, 0xfe, 0xeb, 0x00, 0x23, 0x50, 0x33, 0x65, 0xa5, 0x88, 0xeb, 0x20, 0xb2, 0x00,
+  0x16, 0xdb, 0x98, 0xcd, 0x22, 0x4e, 0x72, 0xf2, 0xe0, 0xfb, 0x7b, 0xbe, 0x24, 0x59, 0xd0, 0x90,
+  0xf0, 0x03, 0x14, 0x51, 0x62, 0x08, 0xf1, 0x7d, 0x18, 0x84, 0x10, 0xa4, 0x77, 0x95, 0xdd, 0x54,
+  0x95, 0xe2, 0x23, 0xd1, 0x38, 0xae, 0x4b, 0x2c, 0x3e, 0x83, 0x50, 0x9b, 0x07, 0x98, 0x55, 0x53,
+  0x7f, 0x9a, 0xa1, 0x6a, 0x8b, 0x90, 0x51, 0x97, 0xe3, 0x8e, 0x85, 0x53, 0x01, 0x40, 0x3d, 0x70,
+  0xa7, 0x06, 0x4e, 0x41, 0x74, 0x28, 0xc0, 0xcf, 0xf4, 0x79, 0x7f, 0x86, 0x49, 0x89, 0x62, 0x33,
+  0x50, 0x60, 0xc9, 0x02, 0x34, 0x15, 0xf8, 0x69, 0xbf, 0x5d, 0x19, 0x07, 0xfc, 0xac, 0xa5, 0x3f,
+  0xe5, 0x1a, 0x93, 0x77, 0x4d, 0xb3, 0x37, 0xf5, 0xb7, 0x2b, 0xb7, 0xd4, 0xb5, 0xf5, 0xcc, 0x57,
+  0xcd, 0x40, 0x2b, 0x4b, 0x33, 0x7c, 0xda, 0x08, 0xe4, 0x5a, 0x22, 0xba, 0x78, 0x3e, 0x00, 0xd0,
+  0x4a, 0x9e, 0x61, 0xeb, 0x86, 0xd5, 0xdc, 0x60, 0x0e, 0xf7, 0x4c, 0x1b, 0x55, 0xb9, 0x30, 0x6b,
+  0x14, 0x3b, 0x4d, 0x30, 0xe7, 0x49, 0x36, 0xe2, 0x00, 0xa4, 0x34, 0xc9, 0x07, 0x72, 0x45, 0x02,
+  0x18, 0xf4, 0x3b, 0x18, 0x67, 0xe8, 0x87, 0x31, 0x8e, 0x9b, 0x53, 0xa8, 0x95, 0xa2, 0x14, 0x20,
+  0xfb, 0x2b, 0xdc, 0x37, 0x42, 0xaa, 0x60, 0x54, 0x97, 0x42, 0xf3, 0xdc, 0xdb, 0xae, 0x82, 0x8f,
+  0xbd, 0x86, 0xcf, 0xca, 0xd1, 0xbc, 0x01, 0xda, 0xb7, 0xf7, 0x10, 0xef, 0xdb, 0x19, 0xf9, 0x6a,
+  0x4d, 0x70, 0x6f, 0x29, 0xca, 0xb8, 0x0f, 0x50, 0xb1, 0xb9, 0xa0, 0x02, 0x9a, 0x9d, 0x6b, 0xff,
+  0xec, 0xea, 0xe5, 0x8b, 0x0a, 0x8d, 0x54, 0x12, 0x58, 0xea, 0xc2, 0xd3, 0x90, 0xce, 0x72, 0x4c,
+  0xe4, 0x54, 0xa5, 0xc5, 0xdb, 0x14, 0x71, 0x85, 0x2c, 0x04, 0xb7, 0x6f, 0x68, 0xcb, 0x4a, 0x2f,
+  0x98, 0xde, 0x47, 0x34, 0x5f, 0x69, 0xa2, 0xeb, 0xac, 0x9c, 0xbf, 0x7c, 0x2e, 0x8f, 0x67, 0x9e,
+  0xc9, 0x83, 0x08, 0xa5, 0xfb, 0x3d, 0x75, 0x03, 0xa3, 0xb3, 0x57, 0xd8, 0x2c, 0xe8, 0xec, 0xa9,
+  0x47, 0xcc, 0xc5, 0x68, 0x21, 0x2f, 0x56, 0x52, 0xae, 0xa3, 0x6a, 0x7a, 0x29, 0xe6, 0xa8, 0x2a,
+  0x1f, 0x8a, 0xc3, 0xdb, 0x95, 0xf0, 0xe1, 0x7a, 0x37, 0x8c, 0xb6, 0x83, 0xba, 0x9a, 0x88, 0x84,
+  0xb4, 0xde, 0xd1, 0xc4, 0xea, 0x5d, 0x5c, 0x5d, 0xd6, 0xec, 0x8d, 0x8f, 0xa8, 0x41, 0x07, 0x56,
+  0xef, 0x08, 0x16, 0xd4, 0x9b, 0x7c, 0x6b, 0xf5, 0x66, 0x26, 0x3e, 0x16, 0x37, 0xb1, 0x7b, 0x67,
+  0x90, 0x1a, 0xe0, 0x91, 0x03, 0xb2, 0x89, 0xe7, 0xa5, 0xab, 0x53, 0x08, 0xe8, 0xc4, 0xce, 0x37,
+  0x17, 0x07, 0xfe, 0xa0, 0x1a, 0xe9, 0xd7, 0x5e, 0xb9, 0xdc, 0xa6, 0xff, 0x36, 0x8c, 0x45, 0x27,
+  0xf4, 0x44, 0x4b, 0xdf, 0x80, 0xb4, 0x4a, 0xff, 0xad, 0x88, 0x37, 0xf0, 0x97, 0xdd, 0x95, 0x94,
+  0xdc, 0xad, 0x27, 0xea, 0x1b, 0xb8, 0x2a, 0x5c, 0x60, 0x04, 0x70, 0x64, 0x70, 0x88, 0x83, 0xaf,
+  0x52, 0x52, 0x00, 0x44, 0x94, 0x67, 0xc8, 0xcc, 0xd4, 0x71, 0x69, 0x83, 0x44, 0xeb, 0x3d, 0xc3,
+  0x75, 0x28, 0x7d, 0xea, 0xe9, 0x6b, 0x76, 0x14, 0xcf, 0x9c, 0x80, 0x3a, 0x52, 0x82, 0xc0, 0x5e,
+  0xcd, 0xfe, 0xf3, 0xef, 0xad, 0x26, 0x08, 0x0c, 0x2a, 0x7b, 0x0a, 0xfa, 0x47, 0xd5, 0x19, 0x75,
+  0x2b, 0x92, 0x2b, 0x6d, 0xf3, 0xad, 0x41, 0x3b, 0x7f, 0x51, 0x5d, 0xdc, 0xed, 0xd3, 0x7a, 0xff,
+  0xfb, 0xc7, 0xdf, 0xfe, 0x3b, 0x48, 0x61, 0xd6, 0x66, 0x4f, 0x47, 0x4c, 0x5e, 0x7b, 0x60, 0x78,
+  0x2f, 0x09, 0x7c, 0x64, 0x30, 0xc4, 0xcb, 0x8f, 0x06, 0x73, 0x5c, 0xbc, 0x87, 0x47, 0x03, 0x22,
+  0x23, 0x2c, 0x84, 0xd5, 0x52, 0xec, 0x8e, 0x33, 0x60, 0x3e, 0x5c, 0x88, 0xf1, 0xd7, 0x71, 0xdd,
+  0x70, 0xb6, 0x44, 0x73, 0x52, 0x4f, 0xa0, 0xd6, 0x5a, 0xd0, 0x65, 0xe2, 0x0d, 0xc5, 0x74, 0x06,
+  0x83, 0x57, 0xb8, 0x10, 0x19, 0xb5, 0x1c, 0x8f, 0x3c, 0x05, 0xe6, 0x7c, 0x3a, 0xa3, 0x03, 0xd0,
+  0x9e, 0x84, 0x68, 0xad, 0x0f, 0xda, 0xe2, 0x59, 0x11, 0x8b, 0x13, 0xc7, 0xde, 0x66, 0xce, 0x53,
+  0xc9, 0x5c, 0xaf, 0x4e, 0xa5, 0xee, 0xd7, 0xa0, 0xdd, 0x18, 0x4c, 0x0f, 0xa1, 0x76, 0x66, 0x32,
+  0x6d, 0xb0, 0x13, 0xa3, 0x4f, 0x24, 0xf1, 0xa7, 0xb9, 0xcc, 0x09, 0x23, 0x77, 0x0e, 0xb6, 0x95,
+  0xfd, 0x8c, 0x72, 0x57, 0xf6, 0xd3, 0x06, 0x3b, 0xb1, 0x9f, 0x1e, 0xa1, 0xb1, 0xd2, 0xe4, 0xd2,
+  0xd1, 0x0b, 0x93, 0xb8, 0x77, 0x4a, 0x78, 0xb3, 0x1b, 0xdd, 0x92, 0xdd, 0x4b, 0xaf, 0xb0, 0x48,
+  0x4b, 0x15, 0x8f, 0x52, 0x40, 0x84, 0x32, 0x84, 0xf0, 0xf3, 0x7d, 0xf7, 0x47, 0xe3, 0x10, 0xc2,
+  0x19, 0xe5, 0x84, 0xf1, 0x18, 0x0f, 0x6d, 0xba, 0x49, 0x38, 0x1e, 0xe3, 0xf9, 0xc5, 0x8f, 0x52,
+  0xdb, 0xc9, 0x9e, 0xff, 0x04, 0xc1, 0x53, 0x1d, 0xfb, 0xf6, 0x9b, 0xb3, 0xea, 0xb7, 0xdf, 0xf4,
+  0x8f, 0xaa, 0xa2, 0xc7, 0x4f, 0x70, 0x91, 0x7a, 0x0d, 0x8a, 0x23, 0x24, 0x2b, 0xb3, 0x42, 0xe7,
+  0xe2, 0xf9, 0x10, 0x2d, 0xf3, 0x81, 0x44, 0xdb, 0x56, 0x6c, 0x7e, 0x75, 0x08, 0x98, 0xa2, 0x2c,
+  0x2c, 0x6c, 0xe3, 0x9c, 0x88, 0xb8, 0x30, 0x9b, 0x94, 0x77, 0xc9, 0x85, 0xe4, 0xfc, 0x68, 0x10,
+  0x6d, 0xe0, 0x86, 0x1e, 0xf2, 0x61, 0x29, 0x4f, 0x29, 0xff, 0xe9, 0x09, 0xa1, 0xca, 0x56, 0xee,
+  0x30, 0x71, 0x07, 0xce, 0x52, 0xfa, 0x22, 0x73, 0x78, 0xcc, 0x98, 0xba, 0xd7, 0xef, 0xc4, 0x1c,
+  0x3d, 0x44, 0x4d, 0xce, 0x4d, 0x8c, 0x2a, 0x1e, 0x86, 0x21, 0xde, 0xb2, 0xe3, 0x47, 0xe4, 0x81,
+  0x32, 0xf3, 0x1c, 0x3c, 0x69, 0x35, 0xa4, 0x76, 0xc9, 0xc4, 0x8b, 0xc5, 0x5e, 0x2f, 0xb0, 0xb2,
+  0x77, 0x14, 0xd2, 0x96, 0x31, 0x13, 0x9b, 0xbf, 0x9a, 0xa9, 0xf5, 0x5e, 0x71, 0xf7, 0xa8, 0x2a,
+  0x4a, 0xd7, 0xaa, 0x2d, 0xad, 0xf7, 0x45, 0xc4, 0x79, 0x70, 0x2f, 0x81, 0xad, 0xf5, 0x4e, 0xe1,
+  0xcb, 0xbd, 0xf5, 0x35, 0xad, 0xf7, 0x15, 0xf7, 0xc9, 0x65, 0xde, 0x43, 0x51, 0x07, 0xbd, 0x58,
+  0x3a, 0xf7, 0x8f, 0xd0, 0xd0, 0x7a, 0xcf, 0x9d, 0x31, 0xa8, 0x8d, 0x73, 0x2f, 0x49, 0x53, 0xeb,
+  0x7d, 0x89, 0x4f, 0x17, 0xdd, 0x4b, 0x70, 0xa0, 0xf5, 0x5e, 0x46, 0x88, 0x91, 0x42, 0x51, 0x15,
+  0x60, 0xee, 0x24, 0x87, 0x2b, 0xb9, 0xaf, 0x77, 0x9f, 0x30, 0xf2, 0x27, 0xb3, 0x9b, 0x25, 0x92,
+  0xa3, 0xd9, 0x41, 0x2c, 0xdb, 0x67, 0x64, 0xe1, 0x0a, 0x3a, 0x9e, 0x24, 0xec, 0x8b, 0x08, 0x75,
+  0xea, 0x7e, 0xe9, 0x9c, 0x3b, 0xd1, 0xfb, 0xed, 0x44, 0xb5, 0xed, 0x2a, 0x50, 0xff, 0x94, 0x0a,
+  0x34, 0x3e, 0xa1, 0x02, 0xcd, 0x4f, 0xaa, 0xc0, 0x01, 0x8a, 0x18, 0x12, 0x60, 0x96, 0xe9, 0xfb,
+  0xf7, 0x94, 0x53, 0xba, 0x60, 0xab, 0x46, 0x2c, 0x77, 0xe3, 0x32, 0x97, 0x2c, 0x62, 0x09, 0x7a,
+  0xd2, 0x21, 0x16, 0x82, 0xf4, 0x82, 0xd9, 0x3c, 0x61, 0x98, 0xba, 0x83, 0xc9, 0xa3, 0xdc, 0x34,
+  0xb5, 0xa1, 0xc6, 0xa6, 0x5e, 0x80, 0x30, 0xb0, 0xa9, 0x73, 0x0b, 0xc0, 0xdb, 0xda, 0x5e, 0x18,
+  0x50, 0x93, 0xee, 0x8f, 0x94, 0xb3, 0x67, 0x65, 0x10, 0x43, 0x15, 0xed, 0xde, 0x7d, 0xe6, 0x89,
+  0x41, 0x4a, 0x41, 0x0d, 0xf6, 0xe4, 0xdc, 0x94, 0x67, 0xcf, 0x68, 0x81, 0x9a, 0x62, 0x92, 0xbe,
+  0x1e, 0xeb, 0xe4, 0x9f, 0xb9, 0x92, 0x80, 0x88, 0xc7, 0x18, 0x5a, 0x12, 0x90, 0x57, 0x38, 0x72,
+  0x9b, 0xd5, 0xcb, 0x96, 0x2d, 0xa7, 0xcc, 0x4a, 0xae, 0xb8, 0x52, 0xd1, 0x66, 0x87, 0xb0, 0xe8,
+  0x50, 0xdf, 0xbb, 0xe1, 0x2a, 0x9f, 0x1d, 0x2b, 0x40, 0x2b, 0x4a, 0xbf, 0x1f, 0xba, 0xf2, 0xfa,
+  0x81, 0x00, 0xd8, 0x94, 0x00, 0xd7, 0xee, 0xc3, 0x57, 0x1d, 0x69, 0x47, 0x88, 0x45, 0x93, 0xff,
+  0x2f, 0x94, 0xcd, 0x72, 0x6d, 0x1d, 0x64, 0x6b, 0x67, 0x90, 0x9f, 0xc3, 0xa2, 0xc1, 0xc4, 0xad,
+  0x0a, 0x96, 0x6e, 0x82, 0xa8, 0x68, 0xaf, 0x5f, 0xba, 0x28, 0xa0, 0x9e, 0x5e, 0xec, 0xdd, 0x06,
+  0xfb, 0x86, 0xfb, 0x1c, 0x02, 0x7e, 0x4b, 0xc2, 0xdf, 0x34, 0x37, 0xe1, 0x7f, 0xdf, 0xd8, 0x5b,
+  0xe5, 0x80, 0x8d, 0x3c, 0x49, 0x7e, 0x2c, 0x99, 0xfb, 0xa1, 0x64, 0xb1, 0x92, 0x82, 0x55, 0x6e,
+  0x9a, 0x59, 0x5c, 0xbf, 0x92, 0x43, 0x43, 0x91, 0xc3, 0xb6, 0x78, 0x26, 0x3b, 0xda, 0x7c, 0x24,
+  0x52, 0x35, 0x71, 0xfd, 0xe3, 0x9e, 0xc0, 0x26, 0x2f, 0x40, 0x35, 0xc5, 0xc3, 0x2e, 0x54, 0xe1,
+  0xc9, 0x3b, 0x31, 0xf9, 0x20, 0x42, 0x59, 0x41, 0x92, 0x0f, 0x6b, 0xcb, 0x46, 0x7a, 0x22, 0x7b,
+  0x9c, 0x7c, 0x28, 0xa0, 0x96, 0xe7, 0x22, 0x7d, 0xfc, 0x07, 0x1f, 0x4c, 0xa1, 0x01, 0x76, 0xf7,
+  0x97, 0xca, 0x0c, 0x73, 0xcc, 0xe6, 0x2f, 0xe1, 0xec, 0x10, 0xf9, 0x60, 0x0b, 0x71, 0x7b, 0xe6,
+  0x9e, 0xc0, 0xcc, 0xb2, 0xab, 0x76, 0x9d, 0xe1, 0x9d, 0x9d, 0xef, 0x16, 0x00, 0x89, 0x0b, 0x3c,
+  0x0c, 0x6f, 0xf0, 0xe4, 0x3d, 0x4f, 0xfe, 0xae, 0xcf, 0x0e, 0x2c, 0xca, 0x26, 0x1f, 0xf0, 0x2e,
+  0xd0, 0x66, 0x1e, 0xd5, 0xc1, 0xbe, 0x5b, 0x0c, 0x89, 0x9b, 0x7d, 0x12, 0xc6, 0x35, 0xc9, 0x2a,
+  0x17, 0x8b, 0x8a, 0x12, 0x5e, 0x55, 0x1d, 0x8b, 0x8f, 0x1d, 0xc2, 0x82, 0xf3, 0xf3, 0xea, 0xf3,
+  0xe7, 0xd5, 0xaf, 0xbe, 0x62, 0x25, 0xb3, 0x55, 0x35, 0xad, 0xaa, 0xdd, 0xd4, 0xb7, 0x05, 0x09,
+  0x40, 0x0b, 0x2d, 0x88, 0xdc, 0xaa, 0x42, 0x8b, 0x6d, 0xe4, 0x10, 0x2d, 0x7c, 0x05, 0xff, 0x94,
+  0x9f, 0x3f, 0x2f, 0x9f, 0x9f, 0xb3, 0x92, 0x6d, 0xda, 0xcd, 0xb2, 0x69, 0x95, 0xcd, 0x96, 0xbe,
+  0x2d, 0x76, 0x38, 0x3f, 0xaf, 0x3c, 0x7f, 0x5e, 0xc1, 0x86, 0xc8, 0x52, 0xc5, 0xb4, 0x2a, 0xd8,
+  0x50, 0xdf, 0x16, 0x4f, 0x00, 0x3d, 0xb4, 0x92, 0x4d, 0xac, 0x0a, 0xb4, 0x2a, 0x36, 0x49, 0x95,
+  0xf8, 0x7b, 0xb9, 0x65, 0x91, 0xe7, 0xbf, 0x08, 0x13, 0xb0, 0xc0, 0x13, 0xca, 0xe4, 0x29, 0x21,
+  0x0f, 0x47, 0xab, 0x84, 0x7e, 0xea, 0xe0, 0x6b, 0x80, 0x58, 0xc0, 0xb9, 0x8b, 0x6f, 0xed, 0x81,
+  0xfc, 0x7e, 0xc8, 0x23, 0xdc, 0xd6, 0x90, 0x8f, 0xc6, 0xc4, 0xbb, 0x39, 0x8b, 0x3e, 0xde, 0xc9,
+  0x62, 0x57, 0xcb, 0x60, 0xb8, 0x93, 0x83, 0xc0, 0xeb, 0x5c, 0xaa, 0x16, 0xab, 0x57, 0xbe, 0x36,
+  0x4c, 0xf1, 0x7e, 0x6f, 0xb1, 0xba, 0x88, 0x56, 0x54, 0x29, 0xaa, 0x39, 0xc6, 0xaa, 0x1d, 0x74,
+  0x09, 0x86, 0x0e, 0x5c, 0xc7, 0x07, 0x1f, 0xb3, 0x35, 0xce, 0x14, 0xb7, 0xca, 0x4a, 0x31, 0x4c,
+  0x33, 0xc6, 0x4b, 0x65, 0x06, 0xb8, 0x57, 0x74, 0xae, 0x03, 0xee, 0xe0, 0x29, 0xc5, 0x56, 0x85,
+  0x12, 0x17, 0xd5, 0xb0, 0x39, 0xdd, 0xdf, 0xc4, 0x53, 0x06, 0xdc, 0x40, 0x17, 0x37, 0xd5, 0x36,
+  0x4b, 0xfc, 0x13, 0xab, 0xa4, 0xb8, 0x46, 0x22, 0x99, 0x92, 0x49, 0xd5, 0x1a, 0xa8, 0xca, 0xe5,
+  0xbb, 0x1d, 0x5c, 0x83, 0x00, 0x4d, 0x6c, 0x88, 0x01, 0x6c, 0xf2, 0x8e, 0xcc, 0xa3, 0x47, 0xf2,
+  0x6a, 0x8c, 0x7a, 0x77, 0xcf, 0x6c, 0x5b, 0xfa, 0xca, 0x63, 0xa4, 0x5b, 0x65, 0x59, 0xa6, 0xfc,
+  0xbd, 0xb5, 0xf5, 0x4c, 0xc0, 0x23, 0xcf, 0x17, 0x62, 0x60, 0x1c, 0x94, 0x33, 0x59, 0x84, 0x10,
+  0xbc, 0xc7, 0x13, 0xda, 0x9d, 0xca, 0x50, 0xd3, 0x62, 0x71, 0x96, 0x43, 0x87, 0x38, 0xaf, 0xcf,
+  0x2f, 0xd9, 0x14, 0x16, 0x38, 0x6f, 0xe8, 0xc4, 0x49, 0x85, 0x5d, 0x04, 0x78, 0x62, 0xc3, 0xe4,
+  0x73, 0xd0, 0xb2, 0x37, 0x79, 0x2d, 0x10, 0x0f, 0x81, 0xf0, 0x44, 0x62, 0x24, 0x45, 0x42, 0xc2,
+  0xc0, 0x1d, 0x5f, 0x86, 0xcb, 0x1d, 0x6d, 0x32, 0x63, 0x0b, 0x9c, 0x00, 0x98, 0x0a, 0x34, 0x9c,
+  0x56, 0x76, 0xb3, 0x82, 0x17, 0x94, 0x88, 0x60, 0xf8, 0xb2, 0x93, 0x15, 0xc8, 0xcb, 0x86, 0xaa,
+  0xcc, 0xd4, 0x9b, 0x7f, 0xdf, 0xc9, 0x10, 0x72, 0x97, 0x1a, 0x8b, 0xb6, 0x40, 0x95, 0xc7, 0xb2,
+  0x76, 0x07, 0x73, 0x78, 0x39, 0x1a, 0x6d, 0xb3, 0x83, 0x2b, 0x7c, 0xac, 0x71, 0xee, 0xf3, 0x6d,
+  0xea, 0xfe, 0x2a, 0x0c, 0xa7, 0x6c, 0x1c, 0xf2, 0x98, 0xb9, 0x90, 0x77, 0x6d, 0x73, 0x9b, 0x69,
+  0x6f, 0xb8, 0xb7, 0x58, 0xa0, 0xdd, 0xd5, 0x14, 0xfa, 0x74, 0xa4, 0xcf, 0x5e, 0x07, 0x89, 0xe7,
+  0xb7, 0x37, 0x43, 0x23, 0xee, 0x71, 0x6e, 0x06, 0x86, 0xea, 0xee, 0x89, 0x2c, 0x44, 0x3c, 0x56,
+  0x6f, 0x89, 0x70, 0x6c, 0x0d, 0x29, 0xd3, 0x6c, 0x9b, 0xe6, 0x36, 0xac, 0x4c, 0x6b, 0x1b, 0x01,
+  0x00, 0x65, 0xda, 0xdb, 0x08, 0x00, 0x1f, 0xb3, 0xb6, 0x8d, 0x00, 0x16, 0x11, 0xb3, 0xbe, 0x8d,
+  0x00, 0x92, 0x52, 0xb3, 0xb1, 0x8d, 0x00, 0xb2, 0x52, 0xb3, 0xb9, 0x8d, 0x00, 0x92, 0x52, 0xf3,
+  0x60, 0x1b, 0x41, 0x0b, 0x08, 0x5a, 0xdb, 0x08, 0x0e, 0x81, 0xe0, 0x70, 0x2b, 0x50, 0x00, 0xa5,
+  0xb5, 0x1d, 0x4a, 0xc0, 0xd2, 0xda, 0x8a, 0x25, 0xe4, 0xa3, 0x3d, 0x6b, 0x2b, 0x98, 0x16, 0xa0,
+  0x69, 0x6d, 0x45, 0xd3, 0x02, 0x38, 0xad, 0xad, 0x70, 0x5a, 0x80, 0xa7, 0xb5, 0x15, 0x4f, 0x0b,
+  0x00, 0xb5, 0xb6, 0x02, 0x6a, 0x01, 0xa2, 0xd6, 0x56, 0x44, 0x2d, 0x80, 0xd4, 0xda, 0x0a, 0xa9,
+  0x05, 0x98, 0x5a, 0x5b, 0x31, 0xb5, 0x01, 0x53, 0x7b, 0x2b, 0xa6, 0x36, 0x60, 0x6a, 0x6f, 0xd7,
+  0x4f, 0xc0, 0xd4, 0xde, 0x8a, 0xa9, 0x0d, 0x98, 0xda, 0x05, 0x4c, 0x95, 0x98, 0xa5, 0x60, 0x85,
+  0x78, 0x53, 0x7a, 0xb3, 0x0d, 0x42, 0xcd, 0xdf, 0x2c, 0xf0, 0x6f, 0x16, 0xf8, 0x37, 0x0b, 0xfc,
+  0xcc, 0x16, 0xb8, 0x7d, 0xe1, 0x3c, 0x75, 0x86, 0xef, 0x7d, 0x7a, 0x79, 0x43, 0x31, 0x06, 0x59,
+  0x3d, 0x98, 0x50, 0xd8, 0x5b, 0xa9, 0x32, 0xbb, 0xd1, 0xd8, 0xba, 0xb3, 0x52, 0x7c, 0xd6, 0x21,
+  0xbf, 0xab, 0x05, 0xad, 0x37, 0xed, 0xab, 0x6c, 0x1c, 0x74, 0xeb, 0xa6, 0x8a, 0xf0, 0x1b, 0x83,
+  0xac, 0xc9, 0x0f, 0xb6, 0xb9, 0x25, 0xe2, 0xd2, 0x93, 0x84, 0xd1, 0x88, 0xe2, 0x2e, 0x20, 0x52,
+  0xe1, 0xed, 0x67, 0x7c, 0x6f, 0x29, 0x04, 0x8e, 0x31, 0xa3, 0x67, 0xde, 0x29, 0xb2, 0x94, 0x0f,
+  0x99, 0x83, 0x9b, 0xf3, 0x97, 0xe2, 0x1d, 0xaa, 0x3e, 0x12, 0x60, 0xc0, 0x79, 0x76, 0xf9, 0x9a,
+  0x4a, 0xbe, 0xf4, 0xfa, 0x1e, 0xc5, 0x9c, 0xce, 0x0d, 0x67, 0x33, 0x0c, 0x41, 0x77, 0x0c, 0x30,
+  0xaf, 0x96, 0x71, 0xc2, 0xa7, 0x9f, 0x38, 0x5c, 0x3a, 0xc5, 0xb7, 0xca, 0xb6, 0xd9, 0xea, 0xb0,
+  0xbe, 0x44, 0x5f, 0xcb, 0x76, 0xbd, 0x66, 0x5f, 0x99, 0x76, 0xeb, 0x95, 0x5e, 0x38, 0x35, 0xce,
+  0xb7, 0x17, 0xfb, 0xf8, 0xca, 0x53, 0x25, 0xd9, 0x4d, 0x00, 0x71, 0x74, 0xd8, 0xbb, 0xa2, 0x3a,
+  0xd4, 0x18, 0xc8, 0xbc, 0x82, 0x71, 0x01, 0xcc, 0x86, 0x79, 0xd6, 0x3a, 0x68, 0xe5, 0xba, 0xa1,
+  0x07, 0x44, 0x50, 0x81, 0x88, 0xbe, 0xa7, 0x9c, 0x76, 0xa9, 0xcf, 0x86, 0xe4, 0x43, 0xdb, 0x4f,
+  0x33, 0x97, 0x3e, 0xb8, 0x72, 0x3f, 0x7b, 0x38, 0x4c, 0x9e, 0xb9, 0x7e, 0xff, 0x04, 0xdf, 0xdb,
+  0x42, 0x39, 0x31, 0x73, 0x79, 0x02, 0x36, 0x82, 0x1b, 0xfe, 0xca, 0xb8, 0x08, 0x7b, 0x7e, 0xe4,
+  0xa6, 0x84, 0x35, 0x7f, 0x3e, 0xaa, 0xbc, 0xac, 0x0c, 0xe2, 0xe5, 0xeb, 0x13, 0x76, 0xf1, 0xe2,
+  0xe4, 0x14, 0xb2, 0xea, 0xec, 0x6c, 0x74, 0x03, 0xb1, 0x7c, 0x45, 0x98, 0xd6, 0x7b, 0x1d, 0xd3,
+  0x8b, 0x7e, 0xcb, 0xe2, 0xed, 0xbe, 0xf8, 0xdc, 0xa8, 0xcf, 0xe4, 0xfb, 0x7f, 0xc5, 0x2b, 0x75,
+  0xd9, 0xd3, 0x4b, 0xcc, 0x40, 0xf0, 0xe5, 0xc3, 0xac, 0x66, 0x83, 0x18, 0x31, 0x31, 0x5f, 0x78,
+  0x11, 0x58, 0x75, 0x1c, 0xb3, 0xf9, 0x8c, 0xde, 0x1b, 0x92, 0x0d, 0xb5, 0xae, 0x31, 0xf8, 0x2a,
+  0x31, 0xc1, 0x96, 0xa4, 0x65, 0x11, 0xff, 0xd5, 0xdc, 0x93, 0xd9, 0xd3, 0x0c, 0x68, 0x20, 0xa1,
+  0xc2, 0xb7, 0xfb, 0xc2, 0xda, 0x0c, 0x5c, 0xe2, 0x7e, 0x2b, 0x25, 0x45, 0x30, 0xa4, 0x7c, 0x0d,
+  0xb0, 0x17, 0x56, 0xbc, 0xc0, 0x63, 0xa5, 0x72, 0xd9, 0x99, 0x27, 0x13, 0xbd, 0xc2, 0xd2, 0xe7,
+  0x0f, 0xbd, 0x18, 0x59, 0x7f, 0x07, 0x7d, 0xbf, 0xb3, 0x4d, 0xbb, 0xfe, 0x97, 0x5f, 0xff, 0x4e,
+  0xde, 0xc5, 0x1b, 0x84, 0xc9, 0x04, 0x94, 0x7a, 0xcc, 0xf1, 0x11, 0x79, 0xbc, 0x39, 0xb7, 0x0c,
+  0xe7, 0xf2, 0xaa, 0x2c, 0x28, 0x7f, 0x25, 0xe5, 0x92, 0x5e, 0x1f, 0x39, 0x05, 0xa2, 0x10, 0x24,
+  0x79, 0xf9, 0xf2, 0xea, 0x5a, 0x63, 0x0e, 0xdd, 0x6f, 0xe9, 0x6a, 0x55, 0xd1, 0x93, 0xc6, 0x78,
+  0x30, 0x14, 0x5e, 0x85, 0x12, 0xba, 0x19, 0x44, 0xe7, 0x55, 0x6c, 0x56, 0xc6, 0xfb, 0x37, 0xda,
+  0x26, 0x87, 0x46, 0xe2, 0x51, 0xdd, 0x11, 0xbe, 0x2b, 0x59, 0x93, 0xaf, 0x71, 0x4e, 0xdf, 0xb7,
+  0x82, 0x03, 0x0d, 0xf9, 0x0c, 0x22, 0x7d, 0xbc, 0xf0, 0xa9, 0xad, 0x72, 0x60, 0xd1, 0x04, 0xa4,
+  0x33, 0xf5, 0x50, 0x38, 0x84, 0x18, 0xeb, 0xcb, 0x56, 0x9f, 0x23, 0xa7, 0x3d, 0x95, 0xaf, 0x86,
+  0x11, 0xc2, 0xc0, 0xa4, 0x32, 0xe5, 0x09, 0x39, 0xe9, 0x30, 0x3f, 0x1c, 0x23, 0xf6, 0x0e, 0x38,
+  0x10, 0x17, 0xdc, 0x87, 0x78, 0xbb, 0x0a, 0x4a, 0x0a, 0x25, 0x98, 0x4a, 0xab, 0xc2, 0xae, 0x33,
+  0xcf, 0x13, 0x71, 0xca, 0x59, 0x62, 0x71, 0xf7, 0x0e, 0xb8, 0x86, 0x34, 0x0b, 0x72, 0x57, 0xd5,
+  0x8b, 0x20, 0x60, 0x5b, 0x9c, 0xc4, 0xd3, 0x4b, 0xd5, 0xe5, 0x7b, 0xb3, 0xdd, 0xcc, 0x0f, 0xc0,
+  0xc1, 0x8c, 0x5b, 0x6d, 0x2a, 0x1f, 0xcd, 0xda, 0xad, 0x79, 0x3f, 0xe2, 0x9c, 0xe1, 0x03, 0x5a,
+  0x6a, 0x0f, 0xf4, 0xf0, 0xd6, 0xf6, 0xcd, 0x89, 0xf4, 0x71, 0x9d, 0x68, 0x5a, 0xd2, 0x5e, 0x71,
+  0x54, 0x5b, 0x74, 0xa1, 0xc7, 0x9a, 0xae, 0x67, 0x0f, 0x5d, 0x4f, 0x22, 0x3e, 0x02, 0x15, 0x8a,
+  0xb0, 0x56, 0x2b, 0x6e, 0x0c, 0xa7, 0xaf, 0x2b, 0xc2, 0x03, 0xbe, 0xb4, 0xf5, 0xd6, 0x63, 0x7d,
+  0xf1, 0x3a, 0x22, 0x6d, 0x53, 0x61, 0xfa, 0x46, 0x2a, 0xac, 0x74, 0x98, 0x18, 0x16, 0x52, 0xef,
+  0x59, 0xdc, 0xae, 0x56, 0xc7, 0x20, 0xb8, 0xf9, 0xa0, 0x32, 0x0c, 0xa7, 0x55, 0x27, 0x00, 0x15,
+  0x0f, 0x96, 0xbf, 0x84, 0xb6, 0xd1, 0x7b, 0x5e, 0x45, 0x9b, 0xb9, 0xee, 0x5f, 0xbf, 0x7b, 0x85,
+  0xdb, 0x55, 0x67, 0xe2, 0x5a, 0x13, 0x88, 0x70, 0x8c, 0xef, 0x1e, 0x7f, 0x37, 0xf0, 0x9d, 0xe0,
+  0xbd, 0x56, 0x18, 0x06, 0x5f, 0x1e, 0xa5, 0xf5, 0xbe, 0xf0, 0x92, 0x27, 0xf3, 0xc1, 0x51, 0xd5,
+  0x29, 0xb8, 0x94, 0xe2, 0xeb, 0xa3, 0xb4, 0xde, 0xd7, 0x99, 0x3f, 0x28, 0x72, 0x35, 0x88, 0xdf,
+  0x2f, 0xf1, 0x29, 0xa8, 0xea, 0x2c, 0x0a, 0xd1, 0x30, 0x0a, 0xbc, 0x55, 0xa8, 0x3e, 0x0e, 0x87,
+  0x1e, 0x9e, 0x81, 0xec, 0xc2, 0x14, 0x9e, 0x72, 0x42, 0x1b, 0xc1, 0xd5, 0x7d, 0xe0, 0xa9, 0x38,
+  0x6d, 0x70, 0xc5, 0x1b, 0xdf, 0xea, 0x5c, 0x5b, 0xbd, 0xa8, 0x8a, 0xde, 0xdf, 0x0b, 0x43, 0xcd,
+  0x3d, 0x70, 0x3a, 0x68, 0x10, 0x1b, 0x3d, 0xab, 0xfa, 0x16, 0x2c, 0xad, 0xf7, 0x97, 0x3f, 0xe0,
+  0xbb, 0x24, 0xf2, 0x84, 0xdf, 0x6b, 0xd4, 0xc1, 0x92, 0x9d, 0x08, 0x8c, 0xd8, 0x19, 0x61, 0xb4,
+  0xc5, 0xd7, 0xe6, 0xde, 0x5c, 0x05, 0x93, 0x3d, 0x75, 0x62, 0xee, 0xa6, 0x3b, 0x4e, 0x21, 0x84,
+  0x27, 0x5e, 0x00, 0xee, 0x1d, 0x96, 0xe0, 0x96, 0xdd, 0x6c, 0xd2, 0x83, 0x60, 0xc5, 0xcb, 0x73,
+  0x6c, 0xb0, 0x5c, 0x17, 0xda, 0x62, 0xb1, 0xa8, 0x80, 0x07, 0x4d, 0xe6, 0x03, 0x4e, 0xfa, 0xb4,
+  0xc0, 0x73, 0xe1, 0xe3, 0x9b, 0xae, 0xbd, 0xf8, 0xd9, 0x4b, 0xd7, 0x33, 0x6f, 0x3f, 0x38, 0xf1,
+  0xa3, 0xa4, 0x5b, 0xb3, 0xe3, 0x35, 0x91, 0xf5, 0x7e, 0x3a, 0x1c, 0x4c, 0x5b, 0xa6, 0x33, 0xf5,
+  0xc6, 0x4e, 0x4e, 0x44, 0xe9, 0x87, 0xbc, 0xe4, 0x57, 0xa5, 0xf7, 0xe1, 0xff, 0x1f, 0x09, 0x8a,
+  0x46, 0x1a, 0x26, 0x5f, 0x00, 0x00,
+};
+
+#endif // WEB_INDEX_H
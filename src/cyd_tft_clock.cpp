@@ -79,29 +79,39 @@
 #include "Arduino.h"
 
 // ======================== SENSOR CONFIGURATION ========================
-// Choose your sensor type by uncommenting ONE of the following:
-// #define USE_BME280        // BME280: Temperature, Humidity, Pressure sensor
-// #define USE_SHT3X      // SHT3X: Temperature and Humidity sensor (no pressure)
-#define USE_HTU21D     // HTU21D: Temperature and Humidity sensor (no pressure)
+// BME280, SHT3X and HTU21D are all supported by the same firmware; the one
+// connected is detected at boot (see detectSensor()).
 
 // ======================== LIBRARIES ========================
+#ifndef ASYNC_WEB_SERVER
+  #define ASYNC_WEB_SERVER 1  // Set to 1 for the event-driven ESPAsyncWebServer (-DASYNC_WEB_SERVER=0 for the blocking WebServer)
+#endif
+
 #include <WiFi.h>
 #include <WebServer.h>
+#if ASYNC_WEB_SERVER
+#include <AsyncTCP.h>
+#include <ESPAsyncWebServer.h>
+#endif
 #include <WiFiManager.h>
 #include <ArduinoOTA.h>
+#include <Update.h>
 #include <Wire.h>
-#ifdef USE_BME280
-  #include <Adafruit_BME280.h>
-#endif
-#ifdef USE_SHT3X
-  #include <Adafruit_SHT31.h>
-#endif
-#ifdef USE_HTU21D
-  #include <Adafruit_HTU21DF.h>
-#endif
+#include <Preferences.h>
+#include <Adafruit_BME280.h>
+#include <Adafruit_SHT31.h>
+#include <Adafruit_HTU21DF.h>
 #include <time.h>
+#include <esp_sntp.h>
+#include <esp_timer.h>
+#include <esp_wifi.h>
+#include <esp_system.h>
 #include <TFT_eSPI.h>  // Hardware-specific library with optimized performance
+#include <esp_heap_caps.h>
 #include <DNSServer.h> // Required for WiFiManager on ESP32
+#if CONFIG_PM_ENABLE
+#include <esp_pm.h>    // DFS and automatic light sleep, when the core is built with them
+#endif
 
 // ======================== PIN DEFINITIONS ========================
 // TFT Display (built-in on CYD, configured in User_Setup.h)
@@ -123,33 +133,49 @@
 // Boot button (built-in on CYD board)
 #define BOOT_BTN_PIN   0    // Boot button (active LOW)
 
+// Light sensor (built-in LDR next to the display; reads higher in the dark)
+#define LDR_PIN       34
+
 // ======================== DISPLAY CONFIGURATION ========================
-// Virtual LED Matrix dimensions
-#define NUM_MAX           8      // Simulated number of 8x8 LED matrices (2 rows × 4 columns)
-#define MATRIX_WIDTH      8      // Width of each simulated matrix
-#define MATRIX_HEIGHT     8      // Height of each simulated matrix
-#define LINE_WIDTH        32     // Display width in pixels (4 matrices wide)
-#define DISPLAY_ROWS      2      // Number of rows of matrices
-#define TOTAL_WIDTH       32     // Total width: 32 pixels
-#define TOTAL_HEIGHT      16     // Total height: 16 pixels (2 rows of 8)
+#include "matrix_buffer.h"
+
+// Virtual LED Matrix dimensions in LEDs, whole 8x8 modules; override with
+// e.g. -DMATRIX_COLUMNS=64 or -DMATRIX_ROWS=32. The clock faces are laid
+// out for 32x16 and sit at the top left of a larger matrix.
+#ifndef MATRIX_COLUMNS
+  #define MATRIX_COLUMNS  32
+#endif
+#ifndef MATRIX_ROWS
+  #define MATRIX_ROWS     16
+#endif
+#define MATRIX_ROW_GAP    4      // Pixels between module rows on the TFT (authentic spacing)
+
+typedef MatrixBuffer<MATRIX_COLUMNS, MATRIX_ROWS> Matrix;
+static_assert(Matrix::WIDTH >= 32 && Matrix::HEIGHT >= 16, "clock faces need at least 32x16");
+
+constexpr int NUM_MAX = Matrix::MODULES;       // Simulated 8x8 LED matrices
+constexpr int LINE_WIDTH = Matrix::WIDTH;      // Display width in LEDs
+constexpr int DISPLAY_ROWS = Matrix::BANDS;    // Rows of 8x8 matrices
+constexpr int TOTAL_WIDTH = Matrix::WIDTH;
+constexpr int TOTAL_HEIGHT = Matrix::HEIGHT;
+
+// Largest LED that fits the 320x240 panel, capped at the classic 9px (288px across)
+constexpr int minOf(int a, int b) { return a < b ? a : b; }
+constexpr int DEFAULT_LED_SIZE = minOf(9, minOf(320 / TOTAL_WIDTH,
+                                                (240 - (DISPLAY_ROWS - 1) * MATRIX_ROW_GAP) / TOTAL_HEIGHT));
 
 // CYD has a 320x240 display - LED size must fit 32 pixels across 320px width
 // These are now variables that can be changed via web interface
 // NOTE: Reducing ledSize allows more content to fit on screen (e.g., full seconds in 24-hour mode)
 //       Smaller LED sizes (4-8px) prevent truncation; larger sizes (10-12px) may clip seconds
-int ledSize = 9;            // Size of each simulated LED pixel (default: 9 * 32 = 288px)
-int ledSpacing = 1;         // Spacing between LEDs (default: 1, reduce to 0 for tighter spacing)
+int ledSize = DEFAULT_LED_SIZE;  // Size of each simulated LED pixel (default: 9 * 32 = 288px)
+int ledSpacing = 1;         // Gap between neighbouring LEDs in px (default: 1, reduce to 0 for tighter spacing)
 
 // Color definitions (RGB565 format)
 #define LED_COLOR         0xF800 // Red color for LEDs
 #define BG_COLOR          0x0000 // Black background
 #define LED_OFF_COLOR     0x2000 // Dim red for "off" LEDs
 
-// Calculate display dimensions for centering (now calculated dynamically based on ledSize)
-// Plus 4-pixel gap between the two matrix rows (authentic spacing)
-int getDisplayWidth() { return ledSize * TOTAL_WIDTH; }
-int getDisplayHeight() { return ledSize * TOTAL_HEIGHT + 4; }
-
 // ======================== DISPLAY STYLE CONFIGURATION ========================
 #define DEFAULT_DISPLAY_STYLE 1  // Start with realistic style
 
@@ -177,6 +203,11 @@ int getDisplayHeight() { return ledSize * TOTAL_HEIGHT + 4; }
 // ======================== DISPLAY OPTIMIZATION ========================
 #define BRIGHTNESS_BOOST 1  // Set to 1 for maximum brightness
 #define FAST_REFRESH 1      // Set to 1 to only redraw changed pixels
+#define FRAMEBUFFER_RENDER 1 // Set to 1 to render off-screen and flush dirty rectangles
+#ifndef DMA_FLUSH
+  #define DMA_FLUSH 1       // Set to 1 to flush the framebuffer over DMA (-DDMA_FLUSH=0 for synchronous)
+#endif
+#define DMA_CHUNK_PIXELS 4096 // Pixels per DMA staging buffer (two are allocated)
 
 #if DEBUG_ENABLED
   #define DEBUG(x) x
@@ -186,31 +217,39 @@ int getDisplayHeight() { return ledSize * TOTAL_HEIGHT + 4; }
   #define DEBUG_SETTINGS(x)
 #endif
 
+#define PERF_ENABLED DEBUG_ENABLED  // Render pipeline profiling at /api/perf
+
 // ======================== DISPLAY OBJECT ========================
 TFT_eSPI tft = TFT_eSPI();  // TFT_eSPI uses configuration from User_Setup.h
 
 // ======================== DISPLAY BUFFER ========================
-// Virtual screen buffer matching original LED matrix structure
-byte scr[LINE_WIDTH * DISPLAY_ROWS]; // 32 columns × 2 rows = 64 bytes
+// Virtual screen buffer, one packed word per LED row (16 x uint32_t by default).
+// refreshAll() finds changes by XORing it against the last drawn copy.
+Matrix scr;
+int layoutFace = -1;  // Display mode whose glyph layout scr holds (-1 = none)
 
 // ======================== GLOBAL OBJECTS ========================
+#if ASYNC_WEB_SERVER
+AsyncWebServer server(80);
+AsyncEventSource eventSource("/api/events");
+#else
 WebServer server(80);
+#endif
 WiFiManager wifiManager;
 
-// Sensor objects (only one will be initialized based on configuration)
-#ifdef USE_BME280
-  Adafruit_BME280 bme280;
-#endif
-#ifdef USE_SHT3X
-  Adafruit_SHT31 sht3x = Adafruit_SHT31();
-#endif
-#ifdef USE_HTU21D
-  Adafruit_HTU21DF htu21d = Adafruit_HTU21DF();
-#endif
+// Sensor objects (only the detected one is used)
+Adafruit_BME280 bme280;
+Adafruit_SHT31 sht3x = Adafruit_SHT31();
+Adafruit_HTU21DF htu21d = Adafruit_HTU21DF();
 
 // ======================== FONT INCLUDES ========================
 #include "fonts.h"
 #include "timezones.h"
+#include "triple_buffer.h"
+#include "perf_stats.h"
+#include "scheduler.h"
+#include "sensor_history.h"
+#include "web_index.h"
 
 // ======================== TIME VARIABLES ========================
 int hours = 0, minutes = 0, seconds = 0;
@@ -230,11 +269,13 @@ int humidity = 0;
 int pressure = 0;
 bool useFahrenheit = false;
 const char* sensorType = "NONE";  // Will be set based on detected sensor
+uint8_t sensorAddress = 0;        // I2C address the sensor answered on
 
 // ======================== TIMING VARIABLES ========================
-unsigned long lastSensorUpdate = 0;
-unsigned long lastNTPSync = 0;
-unsigned long lastStatusPrint = 0;
+#define SECOND_TICK_GUARD_US  200   // Tick lands this far past the boundary so time() reads the new second
+#define NETWORK_POLL_MS       5     // Longest the network task sleeps between web server polls
+#define WIFI_CONNECT_TIMEOUT  15000 // Wait this long for the saved network before opening the config portal
+#define IP_MESSAGE_HOLD_MS    2500  // How long the IP address is shown once WiFi is up
 
 // ======================== DISPLAY STYLE VARIABLES ========================
 int displayStyle = DEFAULT_DISPLAY_STYLE;  // 0=Default, 1=Realistic
@@ -248,13 +289,527 @@ uint8_t displayRotation = 3;               // Display rotation: 1=normal, 3=180
 
 // ======================== DISPLAY MODES ========================
 int currentMode = 0; // 0=Time+Temp, 1=Time Large, 2=Time+Date
-unsigned long lastModeSwitch = 0;
+int secondsInMode = 0;  // Seconds ticks since the last mode switch
 #define MODE_SWITCH_INTERVAL 5000  // Default interval (not used directly)
 int modeSwitchInterval = 5;  // Mode switch interval in seconds (default: 5, range: 1-60)
+bool nightFace = false;      // Render side: showing the minutes-only night face
 
 // ======================== TIMEZONE ========================
 int currentTimezone = 0;
 
+// ======================== FLEET ROLE ========================
+#define FLEET_STANDALONE  0  // Own NTP, own tick
+#define FLEET_LEADER      1  // Syncs NTP and multicasts time beacons
+#define FLEET_FOLLOWER    2  // Locks to the leader's beacons instead of NTP
+int fleetRole = FLEET_STANDALONE;  // Network side, see FLEET SYNC
+bool fleetMirror = false;          // Leader sends its frame, followers show it
+
+// ======================== NIGHT MODE SETTINGS ========================
+#define NIGHT_OFF        0
+#define NIGHT_SCHEDULE   1  // Between nightStart and nightEnd
+#define NIGHT_AMBIENT    2  // While the light sensor reads dark
+#define NIGHT_EITHER     3  // Schedule or dark
+int nightTrigger = NIGHT_OFF;  // Network side, see POWER
+int nightStart = 22;           // Local hour night begins
+int nightEnd = 7;              // Local hour night ends
+int nightBrightness = 16;      // Backlight duty at night (0-255)
+
+// ======================== TASK HANDOFF ========================
+// The render task (core 1) owns scr, the TFT and every global above that
+// affects drawing. The network task (core 0) owns the web server, OTA,
+// sensors and NTP. Network-side changes are made to displayState and handed
+// to the renderer as complete snapshots; finished frames travel back the
+// other way for /api/display. Both directions are lock-free SPSC buffers.
+// With ASYNC_WEB_SERVER, web handlers run on the AsyncTCP task (also core 0);
+// they and the network task take turns on network-side state via NetworkLock.
+#define RENDER_TASK_CORE    1
+#define NETWORK_TASK_CORE   0
+#define TASK_STACK_SIZE     8192
+
+struct DisplayState {
+  // Sensor readings
+  bool sensorAvailable;
+  int temperature;
+  int humidity;
+  int pressure;
+
+  // User settings
+  bool useFahrenheit;
+  bool use24HourFormat;
+  bool showLeadingZero;
+  int dateFormat;
+  int modeSwitchInterval;
+  int displayStyle;
+  uint16_t ledOnColor;
+  uint16_t ledSurroundColor;
+  uint16_t ledOffColor;
+  int ledSize;
+  int ledSpacing;
+  uint8_t displayRotation;
+  bool nightMode;                // Minutes-only face, ticking once a minute
+
+  uint32_t redrawSeq;            // Bumped when a change needs a full TFT redraw
+  uint32_t clockSeq;             // Bumped when local time jumps (timezone change)
+  uint32_t messageSeq;           // Bumped to show message[] on the matrix
+  unsigned long messageHoldMs;   // How long to keep the message up (0 = until replaced)
+  bool messageIsAddress;         // Show message[] as an IP address split over both rows
+  char message[16];
+};
+
+#define DISPLAY_FRAME_VERSION  1     // /api/display.bin layout version
+#define DISPLAY_FRAME_HEADER   12    // Header bytes ahead of the column bytes in /api/display.bin
+
+struct FrameSnapshot {
+  uint32_t seq;                  // Bumped only when the frame content changes
+  Matrix scr;
+  int displayStyle;
+  uint16_t ledOnColor;
+  uint16_t ledSurroundColor;
+};
+
+TaskHandle_t renderTaskHandle = nullptr;
+TaskHandle_t networkTaskHandle = nullptr;
+
+#if ASYNC_WEB_SERVER
+SemaphoreHandle_t networkMutex = nullptr;  // Created in startTasks()
+#endif
+
+// Held while touching network-side state; a no-op when only the network task does.
+// Held briefly and never across a call into AsyncTCP or AsyncEventSource,
+// which take locks of their own. Recursive, since a response filler may run
+// inside the handler that started it.
+class NetworkLock {
+ public:
+#if ASYNC_WEB_SERVER
+  NetworkLock() { xSemaphoreTakeRecursive(networkMutex, portMAX_DELAY); }
+  ~NetworkLock() { xSemaphoreGiveRecursive(networkMutex); }
+#else
+  NetworkLock() {}
+#endif
+};
+
+DisplayState displayState = {};                  // Network-side working copy
+TripleBuffer<DisplayState> displayStateChannel;  // Network -> render
+TripleBuffer<FrameSnapshot> frameChannel;        // Render -> network
+std::atomic<uint32_t> framesRendered(0);         // refreshAll() passes, read by /metrics
+
+// Render-side overlay message state
+bool messageHeld = false;
+unsigned long messageShownAt = 0;
+unsigned long messageHoldMs = 0;
+
+// Network side: seed displayState from the render globals (boot only)
+void captureDisplayState() {
+  displayState.sensorAvailable = sensorAvailable;
+  displayState.temperature = temperature;
+  displayState.humidity = humidity;
+  displayState.pressure = pressure;
+  displayState.useFahrenheit = useFahrenheit;
+  displayState.use24HourFormat = use24HourFormat;
+  displayState.showLeadingZero = showLeadingZero;
+  displayState.dateFormat = dateFormat;
+  displayState.modeSwitchInterval = modeSwitchInterval;
+  displayState.displayStyle = displayStyle;
+  displayState.ledOnColor = ledOnColor;
+  displayState.ledSurroundColor = ledSurroundColor;
+  displayState.ledOffColor = ledOffColor;
+  displayState.ledSize = ledSize;
+  displayState.ledSpacing = ledSpacing;
+  displayState.displayRotation = displayRotation;
+}
+
+// Network side: hand the current displayState to the render task
+void publishDisplayState() {
+  displayStateChannel.back() = displayState;
+  displayStateChannel.publish();
+  if (renderTaskHandle) xTaskNotifyGive(renderTaskHandle);
+}
+
+// Network side: show a message on the matrix (holdMs = 0 keeps it until replaced)
+void postMessage(const char* msg, unsigned long holdMs, bool isAddress = false) {
+  strncpy(displayState.message, msg, sizeof(displayState.message) - 1);
+  displayState.message[sizeof(displayState.message) - 1] = '\0';
+  displayState.messageHoldMs = holdMs;
+  displayState.messageIsAddress = isAddress;
+  displayState.messageSeq++;
+  publishDisplayState();
+}
+
+// Render side: hand the frame just drawn to the network task.
+// Unchanged frames are not republished, so seq only moves on real changes.
+void publishFrame() {
+  static FrameSnapshot last = {};
+  if (last.seq != 0 &&
+      last.scr == scr &&
+      last.displayStyle == displayStyle &&
+      last.ledOnColor == ledOnColor &&
+      last.ledSurroundColor == ledSurroundColor) {
+    return;
+  }
+
+  last.scr = scr;
+  last.displayStyle = displayStyle;
+  last.ledOnColor = ledOnColor;
+  last.ledSurroundColor = ledSurroundColor;
+  last.seq++;
+
+  frameChannel.back() = last;
+  frameChannel.publish();
+}
+
+// ======================== HTTP REQUESTS ========================
+// Route handlers are written once against HttpRequest and run on either server:
+//   ASYNC_WEB_SERVER 1: ESPAsyncWebServer on AsyncTCP. Connections are accepted,
+//     parsed and drained concurrently, so a slow client only holds its own socket
+//     and never the network task.
+//   ASYNC_WEB_SERVER 0: the blocking WebServer, polled by the network task.
+// Generated bodies are pulled, never collected: sendBody() hands the server a
+// filler that formats the next part of the body straight into its send buffer
+// whenever the socket has room (the blocking server loops it over one stack
+// chunk), so no buffer grows with the body. sendFormatted() is the one-piece
+// case for small JSON replies. send() is for short literal replies and
+// sendStatic() serves data that lives in flash as-is.
+#define HTTP_MAX_HEADERS     4
+#define HTTP_LENGTH_UNKNOWN  ((size_t)-1)
+#define HTTP_FILL_CHUNK      768   // Blocking server: body bytes formatted per chunk
+#if ASYNC_WEB_SERVER
+  #define HTTP_FILL_AGAIN    RESPONSE_TRY_AGAIN
+#else
+  #define HTTP_FILL_AGAIN    ((size_t)-1)
+#endif
+
+std::atomic<uint32_t> httpRequests(0);  // Requests handled, all routes
+
+// Per-response state of a filler, set when the response starts. Two words,
+// so the async server's std::function holds it without allocating.
+struct HttpCursor {
+  uint32_t pos;
+  uint32_t arg;
+};
+
+// Writes the body from byte `index` on into buf (at most maxLen bytes) and
+// returns the bytes written: 0 once the body is complete, HTTP_FILL_AGAIN if
+// the next piece needs more room than maxLen. Fillers run on the server's
+// send path after the handler has returned, so they lock what they read.
+typedef size_t (*HttpFiller)(uint8_t* buf, size_t maxLen, size_t index, HttpCursor& cursor);
+
+// Filler for a body Format() writes in one go into a Size-byte stack buffer,
+// sent whole so it is one consistent snapshot
+template <int (*Format)(char* out, size_t size), size_t Size>
+size_t fillFormatted(uint8_t* buf, size_t maxLen, size_t index, HttpCursor&) {
+  if (index > 0) return 0;
+  char body[Size];
+  int len;
+  {
+    NetworkLock lock;
+    len = Format(body, sizeof(body));
+  }
+  if ((size_t)len > maxLen) return HTTP_FILL_AGAIN;
+  memcpy(buf, body, len);
+  return len;
+}
+
+class HttpRequest {
+ public:
+#if ASYNC_WEB_SERVER
+  explicit HttpRequest(AsyncWebServerRequest* request) : request(request), headerCount(0) {}
+
+  bool hasArg(const char* name) { return request->hasArg(name); }
+  String arg(const char* name) { return request->arg(name); }
+  String header(const char* name) { return request->header(name); }
+  size_t contentLength() { return request->contentLength(); }
+  const void* id() const { return request; }  // Same for every callback of one request
+
+  bool authenticate(const char* user, const char* pass) { return request->authenticate(user, pass); }
+  void requestAuthentication() { request->requestAuthentication(); }
+
+  // Name and value must stay valid until the response is sent
+  void sendHeader(const char* name, const char* value) {
+    if (headerCount < HTTP_MAX_HEADERS) {
+      headers[headerCount][0] = name;
+      headers[headerCount][1] = value;
+      headerCount++;
+    }
+  }
+
+  void send(int code, const char* type = nullptr, const char* body = "") {
+    finish(request->beginResponse(code, type ? type : "text/plain", body));
+  }
+
+  void sendStatic(int code, const char* type, const uint8_t* data, size_t len) {
+    finish(request->beginResponse_P(code, type, data, len));
+  }
+
+  // Known lengths go out as Content-Length, unknown ones chunked
+  template <HttpFiller Fill>
+  void sendBody(int code, const char* type, size_t length, HttpCursor cursor) {
+    AwsResponseFiller filler = [cursor](uint8_t* buf, size_t maxLen, size_t index) mutable {
+      return Fill(buf, maxLen, index, cursor);
+    };
+    AsyncWebServerResponse* response = (length == HTTP_LENGTH_UNKNOWN)
+        ? request->beginChunkedResponse(type, filler)
+        : request->beginResponse(type, length, filler);
+    response->setCode(code);
+    finish(response);
+  }
+
+  template <int (*Format)(char* out, size_t size), size_t Size>
+  void sendFormatted(int code, const char* type) {
+    sendBody<fillFormatted<Format, Size> >(code, type, HTTP_LENGTH_UNKNOWN, HttpCursor());
+  }
+
+ private:
+  void finish(AsyncWebServerResponse* response) {
+    for (int i = 0; i < headerCount; i++) response->addHeader(headers[i][0], headers[i][1]);
+    request->send(response);
+  }
+
+  AsyncWebServerRequest* request;
+  const char* headers[HTTP_MAX_HEADERS][2];
+  int headerCount;
+#else
+  HttpRequest() {}
+
+  bool hasArg(const char* name) { return server.hasArg(name); }
+  String arg(const char* name) { return server.arg(name); }
+  String header(const char* name) { return server.header(name); }
+  size_t contentLength() { return server.clientContentLength(); }
+  const void* id() const { return nullptr; }  // One request at a time
+
+  bool authenticate(const char* user, const char* pass) { return server.authenticate(user, pass); }
+  void requestAuthentication() { server.requestAuthentication(); }
+
+  void sendHeader(const char* name, const char* value) { server.sendHeader(name, value); }
+
+  void send(int code, const char* type = nullptr, const char* body = "") { server.send(code, type, body); }
+  void sendStatic(int code, const char* type, const uint8_t* data, size_t len) {
+    server.send_P(code, type, (PGM_P)data, len);
+  }
+
+  // Unknown length goes out chunked
+  template <HttpFiller Fill>
+  void sendBody(int code, const char* type, size_t length, HttpCursor cursor) {
+    bool chunked = (length == HTTP_LENGTH_UNKNOWN);
+    server.setContentLength(chunked ? CONTENT_LENGTH_UNKNOWN : length);
+    server.send(code, type, "");
+
+    uint8_t buf[HTTP_FILL_CHUNK];
+    size_t index = 0;
+    for (;;) {
+      size_t n = Fill(buf, sizeof(buf), index, cursor);
+      if (n == 0 || n == HTTP_FILL_AGAIN) break;  // AGAIN with a whole chunk free would never fit
+      server.sendContent((const char*)buf, n);
+      index += n;
+    }
+    if (chunked) server.sendContent("");
+  }
+
+  // Still in the handler here, so format and send from the stack directly
+  template <int (*Format)(char* out, size_t size), size_t Size>
+  void sendFormatted(int code, const char* type) {
+    char body[Size];
+    int len = Format(body, sizeof(body));
+    server.send_P(code, type, body, len);
+  }
+#endif
+};
+
+// Stages of a request body, as both servers report them (see routeUpload())
+enum UploadStage { UPLOAD_BEGIN, UPLOAD_DATA, UPLOAD_END, UPLOAD_ABORT };
+
+// ======================== SETTINGS STORE ========================
+// User settings persist in NVS as one packed, versioned blob. Web handlers
+// call markSettingsDirty(); the blob is written once things have been quiet
+// for SETTINGS_COMMIT_DELAY, and only if it differs from what's stored, so
+// dragging a slider costs one flash write instead of dozens.
+
+#define SETTINGS_NAMESPACE     "cydclock"
+#define SETTINGS_KEY           "settings"
+#define SETTINGS_VERSION       3
+#define SETTINGS_COMMIT_DELAY  3000  // ms without changes before writing to flash
+
+#define SETTING_FAHRENHEIT        0x01
+#define SETTING_24HOUR            0x02
+#define SETTING_LEADING_ZERO      0x04
+#define SETTING_SURROUND_MATCHES  0x08
+#define SETTING_FLEET_MIRROR      0x10
+
+struct __attribute__((packed)) StoredSettings {
+  uint8_t version;
+  uint8_t flags;               // SETTING_* bits
+  uint8_t dateFormat;
+  uint8_t modeSwitchInterval;
+  uint8_t displayStyle;
+  uint8_t displayRotation;
+  uint8_t ledSize;
+  uint8_t ledSpacing;
+  uint8_t timezone;
+  uint16_t ledOnColor;
+  uint16_t ledSurroundColor;
+  uint16_t ledOffColor;
+  uint8_t fleetRole;           // Added in version 2
+  uint8_t nightTrigger;        // Added in version 3
+  uint8_t nightStart;
+  uint8_t nightEnd;
+  uint8_t nightBrightness;
+};
+
+// Each version only appends, so an older blob is a prefix of this one
+const size_t settingsSizes[SETTINGS_VERSION + 1] = {
+  0, offsetof(StoredSettings, fleetRole), offsetof(StoredSettings, nightTrigger), sizeof(StoredSettings)
+};
+
+Preferences preferences;
+StoredSettings storedSettings = {};   // Last blob read from or written to NVS
+bool settingsDirty = false;
+unsigned long settingsDirtyAt = 0;
+
+// Boot: apply stored settings to the globals before anything is drawn
+void loadSettings() {
+  StoredSettings s = {};
+  preferences.begin(SETTINGS_NAMESPACE, true);
+  size_t len = preferences.getBytes(SETTINGS_KEY, &s, sizeof(s));
+  preferences.end();
+
+  bool valid = s.version >= 1 && s.version <= SETTINGS_VERSION && len == settingsSizes[s.version];
+  if (!valid) {
+    DEBUG(Serial.println("No stored settings - using defaults"));
+    return;
+  }
+
+  useFahrenheit = s.flags & SETTING_FAHRENHEIT;
+  use24HourFormat = s.flags & SETTING_24HOUR;
+  showLeadingZero = s.flags & SETTING_LEADING_ZERO;
+  surroundMatchesLED = s.flags & SETTING_SURROUND_MATCHES;
+  if (s.dateFormat <= 4) dateFormat = s.dateFormat;
+  if (s.modeSwitchInterval >= 1 && s.modeSwitchInterval <= 60) modeSwitchInterval = s.modeSwitchInterval;
+  if (s.displayStyle <= 1) displayStyle = s.displayStyle;
+  if (s.displayRotation == 1 || s.displayRotation == 3) displayRotation = s.displayRotation;
+  if (s.ledSize >= 4 && s.ledSize <= 12) ledSize = s.ledSize;
+  if (s.ledSpacing <= 3) ledSpacing = s.ledSpacing;
+  if (s.timezone < numTimezones) currentTimezone = s.timezone;
+  ledOnColor = s.ledOnColor;
+  ledSurroundColor = s.ledSurroundColor;
+  ledOffColor = s.ledOffColor;
+  fleetMirror = s.flags & SETTING_FLEET_MIRROR;
+  if (s.fleetRole <= FLEET_FOLLOWER) fleetRole = s.fleetRole;
+  if (s.version >= 3) {
+    if (s.nightTrigger <= NIGHT_EITHER) nightTrigger = s.nightTrigger;
+    if (s.nightStart < 24) nightStart = s.nightStart;
+    if (s.nightEnd < 24) nightEnd = s.nightEnd;
+    nightBrightness = s.nightBrightness;
+  }
+
+  storedSettings = s;
+  DEBUG(Serial.printf("Settings restored (v%d, timezone: %s)\n", s.version, timezones[currentTimezone].name));
+}
+
+// Network side: settings changed, schedule a write
+void markSettingsDirty() {
+  settingsDirty = true;
+  settingsDirtyAt = millis();
+}
+
+// Network side: write the settings now if anything changed. The blob is
+// built under the network lock; the NVS write (milliseconds of flash) isn't.
+void commitSettings() {
+  StoredSettings s = {};
+  {
+    NetworkLock lock;
+    settingsDirty = false;
+
+    s.version = SETTINGS_VERSION;
+    s.flags = (displayState.useFahrenheit ? SETTING_FAHRENHEIT : 0) |
+              (displayState.use24HourFormat ? SETTING_24HOUR : 0) |
+              (displayState.showLeadingZero ? SETTING_LEADING_ZERO : 0) |
+              (surroundMatchesLED ? SETTING_SURROUND_MATCHES : 0) |
+              (fleetMirror ? SETTING_FLEET_MIRROR : 0);
+    s.dateFormat = displayState.dateFormat;
+    s.modeSwitchInterval = displayState.modeSwitchInterval;
+    s.displayStyle = displayState.displayStyle;
+    s.displayRotation = displayState.displayRotation;
+    s.ledSize = displayState.ledSize;
+    s.ledSpacing = displayState.ledSpacing;
+    s.timezone = currentTimezone;
+    s.ledOnColor = displayState.ledOnColor;
+    s.ledSurroundColor = displayState.ledSurroundColor;
+    s.ledOffColor = displayState.ledOffColor;
+    s.fleetRole = fleetRole;
+    s.nightTrigger = nightTrigger;
+    s.nightStart = nightStart;
+    s.nightEnd = nightEnd;
+    s.nightBrightness = nightBrightness;
+
+    if (memcmp(&s, &storedSettings, sizeof(s)) == 0) return;  // Nothing new to write
+  }
+
+  preferences.begin(SETTINGS_NAMESPACE, false);
+  bool ok = preferences.putBytes(SETTINGS_KEY, &s, sizeof(s)) == sizeof(s);
+  preferences.end();
+
+  if (ok) {
+    NetworkLock lock;
+    storedSettings = s;
+  }
+  DEBUG(Serial.printf("Settings %s (%u bytes)\n", ok ? "saved" : "save FAILED", (unsigned)sizeof(s)));
+}
+
+// Network timer: commit once changes have settled
+void settingsTimer() {
+  bool settled;
+  {
+    NetworkLock lock;
+    settled = settingsDirty && millis() - settingsDirtyAt >= SETTINGS_COMMIT_DELAY;
+  }
+  if (settled) commitSettings();
+}
+
+// ======================== PERF INSTRUMENTATION ========================
+// Cycle-count histograms for the render pipeline and network work, served at
+// /api/perf. Compiled out entirely when PERF_ENABLED is 0.
+
+#if PERF_ENABLED
+enum PerfProbe {
+  PERF_UPDATE_TIME,       // updateTime() on a new second (render + refresh)
+  PERF_MODE_TIME_TEMP,    // displayTimeAndTemp()
+  PERF_MODE_TIME_LARGE,   // displayTimeLarge()
+  PERF_MODE_TIME_DATE,    // displayTimeAndDate()
+  PERF_REFRESH_ALL,       // refreshAll() including the flush kick-off
+  PERF_LED_PIXELS,        // LEDs redrawn per refreshAll() (count, not cycles)
+  PERF_LED_SPANS,         // drawLEDSpan() calls per refreshAll() (count, not cycles)
+  PERF_HANDLE_CLIENT,     // server.handleClient(), or one route handler with ASYNC_WEB_SERVER
+  PERF_SENSOR_STEP,       // Starting or collecting one sensor conversion
+  PERF_ANIMATION_FRAME,   // One animation frame (compose + refreshAll)
+  PERF_WAKE_LATENCY,      // Seconds tick due to render task running (us, not cycles)
+  PERF_PROBE_COUNT
+};
+
+const char* const perfProbeNames[PERF_PROBE_COUNT] = {
+  "updateTime", "displayTimeAndTemp", "displayTimeLarge", "displayTimeAndDate",
+  "refreshAll", "ledPixels", "ledSpans", "handleClient", "sensorStep", "animationFrame",
+  "wakeLatency"
+};
+
+inline bool perfProbeIsCount(int probe) {
+  return probe == PERF_LED_PIXELS || probe == PERF_LED_SPANS;
+}
+
+// Recorded in microseconds already (the rest are CPU cycles)
+inline bool perfProbeIsMicros(int probe) {
+  return probe == PERF_WAKE_LATENCY;
+}
+
+PerfStat perfStats[PERF_PROBE_COUNT];
+
+  #define PERF_SCOPE(probe) PerfScope perfScope(perfStats[probe])
+  #define PERF_RECORD(probe, value) perfStats[probe].record(value)
+  #define PERF(x) x
+#else
+  #define PERF_SCOPE(probe)
+  #define PERF_RECORD(probe, value)
+  #define PERF(x)
+#endif
+
 // ======================== RGB LED FUNCTIONS ========================
 void setRGBLed(bool red, bool green, bool blue) {
   // CYD RGB LEDs are active LOW
@@ -269,54 +824,74 @@ void flashRGBLed(int r, int g, int b, int delayMs = 200) {
   setRGBLed(false, false, false);
 }
 
+// Non-blocking flash: the LED is switched off later by serviceRGBLed()
+unsigned long rgbPulseOffAt = 0;
+
+void pulseRGBLed(int r, int g, int b, int durationMs = 200) {
+  setRGBLed(r, g, b);
+  rgbPulseOffAt = millis() + durationMs;
+  if (rgbPulseOffAt == 0) rgbPulseOffAt = 1;
+}
+
+void serviceRGBLed() {
+  if (rgbPulseOffAt != 0 && (long)(millis() - rgbPulseOffAt) >= 0) {
+    setRGBLed(false, false, false);
+    rgbPulseOffAt = 0;
+  }
+}
+
 // ======================== TFT DISPLAY FUNCTIONS ========================
 
-void initTFT() {
-  DEBUG(Serial.println("Initializing TFT Display..."));
+void updateLedLayout();
 
-  // Setup backlight pin
-  pinMode(TFT_BL_PIN, OUTPUT);
-  digitalWrite(TFT_BL_PIN, HIGH);  // Turn backlight ON
-  DEBUG(Serial.println("Backlight enabled"));
+#if FRAMEBUFFER_RENDER
+void framebufferBegin();
+#if DMA_FLUSH
+void framebufferDMABegin();
+#endif
+#endif
+void backlightBegin();
 
-  // Add small delay before TFT initialization
-  delay(100);
+void initTFT() {
+  DEBUG(Serial.println("Initializing TFT Display..."));
 
-  // TFT_eSPI initialization
+  // TFT_eSPI initialization (its init sequence includes the panel's reset waits)
   tft.init();
   tft.setRotation(displayRotation);  // Rotation 1 = landscape mode (320x240), 3 = 180° flipped
   DEBUG(Serial.printf("TFT_eSPI initialized, rotation set to %d\n", displayRotation));
 
-  // Small delay after initialization
-  delay(100);
-
   // Check actual dimensions
   DEBUG(Serial.printf("TFT reports dimensions: %d x %d\n", tft.width(), tft.height()));
 
   tft.fillScreen(BG_COLOR);
 
-  // Calculate display dimensions
+  // Backlight on once the panel is cleared, so power-on noise is never seen
+  backlightBegin();
+  DEBUG(Serial.println("Backlight enabled"));
+
+  // Place every LED for this rotation, size and spacing
+  updateLedLayout();
+
   int displayWidth = tft.width();
   int displayHeight = tft.height();
-  int matrixWidth = getDisplayWidth();
-  int matrixHeight = getDisplayHeight();
-  int offsetX = ((displayWidth - matrixWidth) / 2) > 0 ? ((displayWidth - matrixWidth) / 2) : 0;
-  int offsetY = ((displayHeight - matrixHeight) / 2) > 0 ? ((displayHeight - matrixHeight) / 2) : 0;
-
   DEBUG(Serial.printf("TFT Display initialized: %dx%d\n", displayWidth, displayHeight));
-  DEBUG(Serial.printf("LED Matrix area: %dx%d at offset (%d,%d)\n",
-        matrixWidth, matrixHeight, offsetX, offsetY));
   
   if (displayWidth <= 0 || displayHeight <= 0) {
     DEBUG(Serial.println("ERROR: Invalid TFT dimensions!"));
     DEBUG(Serial.println("Check TFT configuration in User_Setup.h"));
   }
+
+#if FRAMEBUFFER_RENDER
+#if DMA_FLUSH
+  framebufferDMABegin();
+#endif
+  framebufferBegin();
+#endif
 }
 
 void clearScreen() {
-  for (int i = 0; i < LINE_WIDTH * DISPLAY_ROWS; i++) {
-    scr[i] = 0;
-  }
+  scr.clear();
+  layoutFace = -1;
 }
 
 // Dim an RGB565 color while preserving hue
@@ -332,96 +907,505 @@ uint16_t dimRGB565(uint16_t color, int factor) {
   return (r << 11) | (g << 5) | b;
 }
 
+void waitForDisplayIdle();
+
 void forceCompleteRefresh() {
+  waitForDisplayIdle();
   tft.fillScreen(BG_COLOR);
   clearScreen();
 }
 
-void drawLEDPixel(int x, int y, bool lit) {
-  // Bounds checking
-  if (x < 0 || x >= TOTAL_WIDTH || y < 0 || y >= TOTAL_HEIGHT) {
+// ======================== LED SPRITE CACHE ========================
+// Realistic-style LEDs are rendered once into small bitmaps and then pushed
+// with a single windowed write per LED instead of ledSize² drawPixel() calls.
+// Pixels are stored byte-swapped (panel order) so they can be sent as-is.
+#define LED_SPRITE_MAX_SIZE 12  // Matches the upper bound of the LED size slider
+
+struct LEDSpriteCache {
+  bool valid;
+  int size;
+  uint16_t onColor;
+  uint16_t surroundColor;
+  uint16_t lit[LED_SPRITE_MAX_SIZE * LED_SPRITE_MAX_SIZE];
+  uint16_t unlit[LED_SPRITE_MAX_SIZE * LED_SPRITE_MAX_SIZE];
+};
+
+LEDSpriteCache ledSprites = {};
+
+// Convert an RGB565 color to the byte order expected by the ILI9341
+inline uint16_t panelOrder(uint16_t color) {
+  return (color << 8) | (color >> 8);
+}
+
+// Drop the cached LED bitmaps if any of their inputs have changed
+void invalidateLEDSprites() {
+  if (ledSprites.size != ledSize ||
+      ledSprites.onColor != ledOnColor ||
+      ledSprites.surroundColor != ledSurroundColor) {
+    ledSprites.valid = false;
+  }
+}
+
+void buildLEDSprites() {
+  int size = constrain(ledSize, 1, LED_SPRITE_MAX_SIZE);
+
+  // OFF LED: dark circle inside a dim housing ring
+  uint16_t offHousing = dimRGB565(ledSurroundColor, 7);
+  uint16_t offLED = 0x1800;  // Very dark red, whatever the LED color
+  int threshInner = (size - 4) * (size - 4);
+  int threshOuter = (size - 2) * (size - 2);
+
+  // LIT LED: bright body with a surround ring
+  int threshBody = (size - 2) * (size - 2);
+  int threshSurround = size * size;
+
+  for (int py = 0; py < size; py++) {
+    for (int px = 0; px < size; px++) {
+      int dx = (px * 2 - size + 1);
+      int dy = (py * 2 - size + 1);
+      int distSq = dx * dx + dy * dy;
+
+      uint16_t litColor = BG_COLOR;
+      if (distSq <= threshBody) {
+        litColor = ledOnColor;
+      }
+      else if (distSq <= threshSurround) {
+        litColor = ledSurroundColor;
+      }
+
+      uint16_t unlitColor = BG_COLOR;
+      bool inner = px >= 1 && px < size - 1 && py >= 1 && py < size - 1;
+      if (inner && distSq <= threshInner) {
+        unlitColor = offLED;
+      }
+      else if (inner && distSq <= threshOuter) {
+        unlitColor = offHousing;
+      }
+
+      ledSprites.lit[py * size + px] = panelOrder(litColor);
+      ledSprites.unlit[py * size + px] = panelOrder(unlitColor);
+    }
+  }
+
+  ledSprites.size = size;
+  ledSprites.onColor = ledOnColor;
+  ledSprites.surroundColor = ledSurroundColor;
+  ledSprites.valid = true;
+
+  DEBUG(Serial.printf("LED sprites rebuilt: %dx%d px\n", size, size));
+}
+
+// ======================== LED LAYOUT ========================
+// Screen position of every LED, worked out once per geometry change
+// (initTFT(), /rotation, /style) so drawing an LED is just a table lookup.
+// LEDs sit ledSize + ledSpacing apart; matrix rows add MATRIX_ROW_GAP.
+struct LedLayout {
+  int size;                        // LED edge in px
+  int pitch;                       // Distance between neighbouring LED origins
+  int width;                       // Matrix area in px
+  int height;
+  int offsetX;                     // Top-left of the matrix area, centered on the TFT
+  int offsetY;
+  int16_t originX[TOTAL_WIDTH];    // Screen x of each LED column
+  int16_t originY[TOTAL_HEIGHT];   // Screen y of each LED row, row gaps included
+};
+
+LedLayout layout = {};
+
+void updateLedLayout() {
+  layout.size = constrain(ledSize, 1, LED_SPRITE_MAX_SIZE);
+  layout.pitch = layout.size + ledSpacing;
+  layout.width = (TOTAL_WIDTH - 1) * layout.pitch + layout.size;
+  layout.height = (TOTAL_HEIGHT - 1) * layout.pitch + layout.size + (DISPLAY_ROWS - 1) * MATRIX_ROW_GAP;
+  layout.offsetX = max((tft.width() - layout.width) / 2, 0);
+  layout.offsetY = max((tft.height() - layout.height) / 2, 0);
+
+  for (int x = 0; x < TOTAL_WIDTH; x++) {
+    layout.originX[x] = layout.offsetX + x * layout.pitch;
+  }
+  for (int y = 0; y < TOTAL_HEIGHT; y++) {
+    layout.originY[y] = layout.offsetY + y * layout.pitch + Matrix::bandOf(y) * MATRIX_ROW_GAP;
+  }
+
+  // Sprites follow the same inputs, so they are always ready when drawing
+  invalidateLEDSprites();
+  if (!ledSprites.valid) {
+    buildLEDSprites();
+  }
+
+  DEBUG(Serial.printf("LED layout: %dx%d px at (%d,%d), %dpx LEDs on a %dpx pitch\n",
+        layout.width, layout.height, layout.offsetX, layout.offsetY, layout.size, layout.pitch));
+}
+
+// ======================== FRAMEBUFFER ========================
+// Optional off-screen rendering backend. LEDs are drawn into RAM and only the
+// dirty LEDs are flushed: each run of dirty LEDs in an LED row, merged with the
+// same run in the rows below, goes out as one setAddrWindow + pushPixels
+// rectangle (a full redraw is still one burst per band, a blinking colon just
+// its own cells).
+// One band covers one matrix row (8 LEDs high) so the inter-row gap needs no
+// RAM and each allocation stays small enough for a fragmented heap
+// (~41 KB per band at the default ledSize of 9).
+#if FRAMEBUFFER_RENDER
+struct FrameBand {
+  uint16_t* pixels;   // width x height, panel byte order
+  int screenY;        // Top edge of the band on the TFT
+  int height;         // Visible rows (clipped to the TFT)
+  uint32_t dirty[Matrix::BAND_HEIGHT][Matrix::WORDS];  // Dirty LEDs, bit per column as in Matrix
+};
+
+struct Framebuffer {
+  bool active;
+  int screenX;        // Left edge of the bands on the TFT
+  int width;          // Visible columns (clipped to the TFT)
+  int cellSize;       // LED size the bands were allocated for
+  int pitch;          // LED pitch the bands were allocated for
+  FrameBand bands[DISPLAY_ROWS];
+};
+
+Framebuffer fb = {};
+
+inline bool framebufferDirty(const FrameBand& band, int row, int x) {
+  return x >= 0 && x < TOTAL_WIDTH && ((band.dirty[row][x / 32] >> (x % 32)) & 1);
+}
+
+// True if LED row `row` has a dirty run of exactly lo..hi
+bool framebufferHasRun(const FrameBand& band, int row, int lo, int hi) {
+  if (framebufferDirty(band, row, lo - 1) || framebufferDirty(band, row, hi + 1)) return false;
+  for (int x = lo; x <= hi; x++) {
+    if (!framebufferDirty(band, row, x)) return false;
+  }
+  return true;
+}
+
+// Take the next dirty rectangle of a band (band pixels) and mark it clean:
+// the first run of dirty LEDs, extended down over rows with the same run.
+// False when the band is clean.
+bool framebufferTakeDirty(FrameBand& band, int& x0, int& y0, int& w, int& h) {
+  for (int r = 0; r < Matrix::BAND_HEIGHT; r++) {
+    int k = 0;
+    while (k < Matrix::WORDS && band.dirty[r][k] == 0) k++;
+    if (k == Matrix::WORDS) continue;
+
+    int lo = k * 32 + __builtin_ctz(band.dirty[r][k]);
+    int hi = lo;
+    while (framebufferDirty(band, r, hi + 1)) hi++;
+
+    int last = r;
+    while (last + 1 < Matrix::BAND_HEIGHT && framebufferHasRun(band, last + 1, lo, hi)) last++;
+    for (int row = r; row <= last; row++) {
+      for (int x = lo; x <= hi; x++) band.dirty[row][x / 32] &= ~(1u << (x % 32));
+    }
+
+    int x1 = min(hi * fb.pitch + fb.cellSize, fb.width);
+    int y1 = min(last * fb.pitch + fb.cellSize, band.height);
+    x0 = lo * fb.pitch;
+    y0 = r * fb.pitch;
+    if (x1 <= x0 || y1 <= y0) continue;
+    w = x1 - x0;
+    h = y1 - y0;
+    return true;
+  }
+  return false;
+}
+
+#if DMA_FLUSH
+// Asynchronous flush: dirty band rows are copied into one of two DMA-capable
+// staging buffers while the other is on the wire, so loop() only pays for a
+// memcpy per chunk and keeps serving the web server and OTA in between.
+struct DMAChunk {
+  int x, y, w, h;     // Target window on the TFT
+};
+
+struct DMAFlush {
+  bool available;     // initDMA() succeeded and staging buffers exist
+  bool writing;       // startWrite() transaction is open
+  int inFlight;       // Staging buffer being transferred, -1 if idle
+  int ready;          // Staging buffer filled and waiting, -1 if none
+  int jobBand;        // Band currently being sent, -1 if none
+  int jobX0, jobW;    // Dirty rectangle being sent (band pixels)
+  int jobRow, jobRowEnd;
+  uint16_t* staging[2];
+  DMAChunk chunks[2];
+};
+
+DMAFlush dma = { false, false, -1, -1, -1, 0, 0, 0, 0, { nullptr, nullptr } };
+
+void framebufferDMABegin() {
+  if (!tft.initDMA()) {
+    DEBUG(Serial.println("DMA: initDMA failed, using synchronous flush"));
     return;
   }
-  
-  // Calculate screen position with centering offset
-  int displayWidth = getDisplayWidth();
-  int displayHeight = getDisplayHeight();
-  int offsetX = ((tft.width() - displayWidth) / 2) > 0 ? ((tft.width() - displayWidth) / 2) : 0;
-  int offsetY = ((tft.height() - displayHeight) / 2) > 0 ? ((tft.height() - displayHeight) / 2) : 0;
+  for (int i = 0; i < 2; i++) {
+    dma.staging[i] = (uint16_t*)heap_caps_malloc(DMA_CHUNK_PIXELS * sizeof(uint16_t), MALLOC_CAP_DMA);
+    if (dma.staging[i] == nullptr) {
+      DEBUG(Serial.println("DMA: staging allocation failed, using synchronous flush"));
+      return;
+    }
+  }
+  dma.available = true;
+  DEBUG(Serial.printf("DMA: enabled, 2 x %d pixel staging buffers\n", DMA_CHUNK_PIXELS));
+}
 
-  // Add extra gap between matrix rows (after row 7, before row 8)
-  int matrixGap = (y >= 8) ? 4 : 0;  // 4-pixel gap between matrix rows
+// Copy the next run of dirty rows into a staging buffer
+bool framebufferStageChunk(int buf) {
+  if (dma.jobBand < 0) {
+    for (int b = 0; b < DISPLAY_ROWS; b++) {
+      int x0, y0, w, h;
+      if (!framebufferTakeDirty(fb.bands[b], x0, y0, w, h)) continue;
+
+      dma.jobBand = b;
+      dma.jobX0 = x0;
+      dma.jobW = w;
+      dma.jobRow = y0;
+      dma.jobRowEnd = y0 + h;
+      break;
+    }
+    if (dma.jobBand < 0) return false;
+  }
 
-  int screenX = offsetX + x * ledSize;
-  int screenY = offsetY + y * ledSize + matrixGap;
-  
-  if (displayStyle == 0) {
-    // ========== DEFAULT STYLE: Solid square blocks ==========
-    uint16_t color = lit ? ledOnColor : BG_COLOR;
-    tft.fillRect(screenX, screenY, ledSize, ledSize, color);
-  }
-  else {
-    // ========== REALISTIC STYLE: Circular LED with surround ==========
-    int center = ledSize / 2;
-    int ledRadius = (ledSize - 2) / 2;  // Leave 1px border
-
-    if (!lit) {
-      // OFF LED: Show dark circle
-      tft.fillRect(screenX, screenY, ledSize, ledSize, BG_COLOR);
-
-      uint16_t offHousing = dimRGB565(ledSurroundColor, 7);
-      uint16_t offLED = 0x1800;  // Very dark red
-
-      for (int py = 1; py < ledSize - 1; py++) {
-        for (int px = 1; px < ledSize - 1; px++) {
-          int dx = (px * 2 - ledSize + 1);
-          int dy = (py * 2 - ledSize + 1);
-          int distSq = dx * dx + dy * dy;
-          int threshInner = (ledSize - 4) * (ledSize - 4);
-          int threshOuter = (ledSize - 2) * (ledSize - 2);
-
-          if (distSq <= threshInner) {
-            tft.drawPixel(screenX + px, screenY + py, offLED);
-          }
-          else if (distSq <= threshOuter) {
-            tft.drawPixel(screenX + px, screenY + py, offHousing);
-          }
+  FrameBand& band = fb.bands[dma.jobBand];
+  int rows = min(dma.jobRowEnd - dma.jobRow, DMA_CHUNK_PIXELS / dma.jobW);
+  uint16_t* dst = dma.staging[buf];
+  for (int row = 0; row < rows; row++) {
+    memcpy(dst + row * dma.jobW, band.pixels + (dma.jobRow + row) * fb.width + dma.jobX0,
+           dma.jobW * sizeof(uint16_t));
+  }
+
+  DMAChunk& chunk = dma.chunks[buf];
+  chunk.x = fb.screenX + dma.jobX0;
+  chunk.y = band.screenY + dma.jobRow;
+  chunk.w = dma.jobW;
+  chunk.h = rows;
+
+  dma.jobRow += rows;
+  if (dma.jobRow >= dma.jobRowEnd) {
+    dma.jobBand = -1;  // The band may have more rectangles; the next call takes them
+  }
+  return true;
+}
+#endif
+
+// Advance the asynchronous flush; called from loop() and after each frame
+void framebufferService() {
+#if DMA_FLUSH
+  if (!fb.active || !dma.available) return;
+
+  if (dma.inFlight >= 0 && !tft.dmaBusy()) {
+    dma.inFlight = -1;
+  }
+  if (dma.ready < 0) {
+    int buf = (dma.inFlight == 0) ? 1 : 0;
+    if (framebufferStageChunk(buf)) dma.ready = buf;
+  }
+  if (dma.inFlight < 0 && dma.ready >= 0) {
+    if (!dma.writing) {
+      tft.startWrite();
+      dma.writing = true;
+    }
+    DMAChunk& chunk = dma.chunks[dma.ready];
+    tft.pushImageDMA(chunk.x, chunk.y, chunk.w, chunk.h, dma.staging[dma.ready]);
+    dma.inFlight = dma.ready;
+    dma.ready = -1;
+
+    // Stage the following chunk while this one is on the wire
+    int buf = dma.inFlight ^ 1;
+    if (framebufferStageChunk(buf)) dma.ready = buf;
+  }
+  if (dma.inFlight < 0 && dma.ready < 0 && dma.writing) {
+    tft.endWrite();
+    dma.writing = false;
+  }
+#endif
+}
+
+// True when no rows are waiting for or on the DMA engine
+bool framebufferIdle() {
+#if DMA_FLUSH
+  return !(dma.writing || dma.ready >= 0 || dma.jobBand >= 0);
+#else
+  return true;
+#endif
+}
+
+// Block until every pending row has reached the TFT
+void framebufferFinish() {
+  while (!framebufferIdle()) {
+    framebufferService();
+  }
+}
+
+void framebufferRelease() {
+  for (int b = 0; b < DISPLAY_ROWS; b++) {
+    free(fb.bands[b].pixels);
+    fb.bands[b].pixels = nullptr;
+  }
+  fb.active = false;
+}
+
+// (Re)allocate the bands for the current LED layout.
+// Falls back to direct rendering if the heap can't hold them.
+void framebufferBegin() {
+  int width = min(layout.width, (int)tft.width() - layout.offsetX);
+  int bandHeight = (Matrix::BAND_HEIGHT - 1) * layout.pitch + layout.size;
+
+  if (fb.active && fb.cellSize == layout.size && fb.pitch == layout.pitch && fb.width == width &&
+      fb.screenX == layout.offsetX && fb.bands[0].screenY == layout.offsetY) {
+    return;  // Geometry unchanged
+  }
+
+  framebufferFinish();
+  framebufferRelease();
+  fb.screenX = layout.offsetX;
+  fb.width = width;
+  fb.cellSize = layout.size;
+  fb.pitch = layout.pitch;
+
+  for (int b = 0; b < DISPLAY_ROWS; b++) {
+    FrameBand& band = fb.bands[b];
+    band.screenY = layout.originY[b * Matrix::BAND_HEIGHT];
+    band.height = min(bandHeight, (int)tft.height() - band.screenY);
+    memset(band.dirty, 0, sizeof(band.dirty));
+    if (width <= 0 || band.height <= 0) {
+      band.pixels = nullptr;
+    } else {
+      // Zeroed = BG_COLOR; the spacing between LEDs is never drawn afterwards
+      band.pixels = (uint16_t*)calloc((size_t)width * band.height, sizeof(uint16_t));
+    }
+
+    if (band.pixels == nullptr) {
+      DEBUG(Serial.printf("Framebuffer: band %d allocation failed, using direct rendering\n", b));
+      framebufferRelease();
+      return;
+    }
+  }
+
+  fb.active = true;
+  DEBUG(Serial.printf("Framebuffer: %d bands of %dx%d px (%u bytes free heap)\n",
+        DISPLAY_ROWS, fb.width, bandHeight, ESP.getFreeHeap()));
+}
+
+// Copy one LED cell into its band and mark it dirty in its LED row.
+// src is a size x size bitmap, or nullptr to fill with a solid color.
+void framebufferDrawCell(int x, int y, const uint16_t* src, uint16_t color) {
+  FrameBand& band = fb.bands[Matrix::bandOf(y)];
+  int size = fb.cellSize;
+  int localX = layout.originX[x] - fb.screenX;
+  int localY = layout.originY[y] - band.screenY;
+  int w = min(size, fb.width - localX);
+  int h = min(size, band.height - localY);
+  if (w <= 0 || h <= 0) return;
+
+  for (int py = 0; py < h; py++) {
+    uint16_t* dst = band.pixels + (localY + py) * fb.width + localX;
+    if (src) {
+      memcpy(dst, src + py * size, w * sizeof(uint16_t));
+    } else {
+      for (int px = 0; px < w; px++) dst[px] = color;
+    }
+  }
+
+  band.dirty[Matrix::bitOf(y)][x / 32] |= 1u << (x % 32);
+}
+
+// Push the dirty rectangles of each band to the TFT
+void framebufferFlush() {
+  if (!fb.active) return;
+
+#if DMA_FLUSH
+  if (dma.available) {
+    framebufferService();  // Kick the transfer; loop() keeps it moving
+    return;
+  }
+#endif
+
+  tft.startWrite();
+  for (int b = 0; b < DISPLAY_ROWS; b++) {
+    FrameBand& band = fb.bands[b];
+    int x0, y0, w, h;
+    while (framebufferTakeDirty(band, x0, y0, w, h)) {
+      tft.setAddrWindow(fb.screenX + x0, band.screenY + y0, w, h);
+      if (w == fb.width) {
+        tft.pushPixels(band.pixels + y0 * fb.width, (uint32_t)w * h);
+      } else {
+        for (int row = y0; row < y0 + h; row++) {
+          tft.pushPixels(band.pixels + row * fb.width + x0, w);
         }
       }
     }
-    else {
-      // LIT LED: Draw bright circular LED with surround
-      tft.fillRect(screenX, screenY, ledSize, ledSize, ledSurroundColor);
-
-      for (int py = 0; py < ledSize; py++) {
-        for (int px = 0; px < ledSize; px++) {
-          int dx = (px * 2 - ledSize + 1);
-          int dy = (py * 2 - ledSize + 1);
-          int distSq = dx * dx + dy * dy;
-
-          uint16_t pixelColor;
-          int threshCore = (ledSize - 6) * (ledSize - 6);
-          int threshBody = (ledSize - 2) * (ledSize - 2);
-          int threshSurround = ledSize * ledSize;
-
-          if (distSq <= threshCore) {
-            pixelColor = ledOnColor;
-          }
-          else if (distSq <= threshBody) {
-            pixelColor = ledOnColor;
-          }
-          else if (distSq <= threshSurround) {
-            pixelColor = ledSurroundColor;
-          }
-          else {
-            pixelColor = BG_COLOR;
-          }
-
-          tft.drawPixel(screenX + px, screenY + py, pixelColor);
-        }
+  }
+  tft.endWrite();
+}
+#endif
+
+// Wait for in-flight framebuffer transfers before drawing to the TFT directly
+void waitForDisplayIdle() {
+#if FRAMEBUFFER_RENDER
+  framebufferFinish();
+#endif
+}
+
+#if !FRAMEBUFFER_RENDER
+bool framebufferIdle() { return true; }  // Direct rendering never leaves work queued
+#endif
+
+// Longest run of pixels one span row can put on the panel
+#define LED_SPAN_MAX_PIXELS 320
+
+// Draw LEDs x0..x1 of matrix row y, all in the same state. Direct rendering
+// sends the whole run (gaps included) through one address window.
+void drawLEDSpan(int x0, int x1, int y, bool lit) {
+  // Bounds checking; folds away for callers looping over the matrix
+  if (x0 > x1 || !Matrix::contains(x0, y) || !Matrix::contains(x1, y)) {
+    return;
+  }
+
+  const uint16_t* sprite = nullptr;
+  uint16_t solid = 0;
+  if (displayStyle == 0) {
+    solid = panelOrder(lit ? ledOnColor : BG_COLOR);
+  } else {
+    sprite = lit ? ledSprites.lit : ledSprites.unlit;
+  }
+
+#if FRAMEBUFFER_RENDER
+  if (fb.active) {
+    for (int x = x0; x <= x1; x++) {
+      framebufferDrawCell(x, y, sprite, solid);
+    }
+    return;
+  }
+#endif
+
+  // Position comes from the precomputed layout (centering and row gaps included)
+  int size = layout.size;
+  int screenX = layout.originX[x0];
+  int screenY = layout.originY[y];
+  int w = min(layout.originX[x1] + size, min((int)tft.width(), screenX + LED_SPAN_MAX_PIXELS)) - screenX;
+  int h = min(size, (int)tft.height() - screenY);
+  if (w <= 0 || h <= 0) return;
+
+  static uint16_t line[LED_SPAN_MAX_PIXELS];
+  if (sprite == nullptr) {
+    // Solid squares: every row of the span is the same
+    for (int px = 0; px < w; px++) {
+      line[px] = ((px % layout.pitch) < size) ? solid : panelOrder(BG_COLOR);
+    }
+  }
+
+  tft.startWrite();
+  tft.setAddrWindow(screenX, screenY, w, h);
+  for (int py = 0; py < h; py++) {
+    if (sprite != nullptr) {
+      const uint16_t* src = sprite + py * size;
+      for (int px = 0; px < w; px++) {
+        int cellX = px % layout.pitch;
+        line[px] = (cellX < size) ? src[cellX] : panelOrder(BG_COLOR);
       }
     }
+    tft.pushPixels(line, w);
   }
+  tft.endWrite();
 }
 
 // Format date according to selected format
@@ -447,43 +1431,61 @@ void formatDate(char* buf, size_t bufSize, int d, int m, int y) {
   }
 }
 
+// Redraw only the LEDs whose state changed. Each packed row is XORed with
+// its last drawn value, and horizontal runs of changed LEDs in the same
+// state go out as one span.
 void refreshAll() {
+  PERF_SCOPE(PERF_REFRESH_ALL);
+  PERF(uint32_t ledPixels = 0);
+  PERF(uint32_t ledSpans = 0);
+  framesRendered.fetch_add(1, std::memory_order_relaxed);
+
   #if FAST_REFRESH
-    static byte lastScr[LINE_WIDTH * DISPLAY_ROWS] = {0};
+    static Matrix lastScr = {};
     static bool firstRun = true;
     
     if (forceFullRedraw) {
-      for (int i = 0; i < LINE_WIDTH * DISPLAY_ROWS; i++) {
-        lastScr[i] = 0xFF;
-      }
       forceFullRedraw = false;
       firstRun = true;
       DEBUG(Serial.println("FAST_REFRESH cache cleared - forcing full redraw"));
     }
   #endif
   
-  for (int row = 0; row < DISPLAY_ROWS; row++) {
-    for (int displayX = 0; displayX < LINE_WIDTH; displayX++) {
-      int bufferIndex = displayX + row * LINE_WIDTH;
-      
-      if (bufferIndex >= 0 && bufferIndex < LINE_WIDTH * DISPLAY_ROWS) {
-        byte pixelByte = scr[bufferIndex];
-        
-        #if FAST_REFRESH
-          if (firstRun || pixelByte != lastScr[bufferIndex]) {
-            lastScr[bufferIndex] = pixelByte;
-        #endif
-            
-            for (int bitPos = 0; bitPos < 8; bitPos++) {
-              int displayY = row * 8 + bitPos;
-              bool lit = (pixelByte & (1 << bitPos)) != 0;
-              
-              drawLEDPixel(displayX, displayY, lit);
-            }
-            
-        #if FAST_REFRESH
-          }
-        #endif
+  for (int displayY = 0; displayY < TOTAL_HEIGHT; displayY++) {
+    // Bit n of changed[k] set = LED k * 32 + n of this row needs drawing
+    uint32_t changed[Matrix::WORDS];
+    for (int k = 0; k < Matrix::WORDS; k++) {
+      #if FAST_REFRESH
+        changed[k] = firstRun ? Matrix::wordMask(k) : (scr.rows[displayY][k] ^ lastScr.rows[displayY][k]);
+        lastScr.rows[displayY][k] = scr.rows[displayY][k];
+      #else
+        changed[k] = Matrix::wordMask(k);
+      #endif
+    }
+
+    int spanStart = -1;
+    bool spanLit = false;
+
+    // One step past the end closes the last open span
+    for (int displayX = 0; displayX <= LINE_WIDTH; displayX++) {
+      // Skip whole words with nothing to draw
+      if (spanStart < 0 && displayX % 32 == 0 && displayX < LINE_WIDTH && changed[displayX / 32] == 0) {
+        displayX += 31;
+        continue;
+      }
+
+      bool draw = displayX < LINE_WIDTH && ((changed[displayX / 32] >> (displayX % 32)) & 1);
+      bool lit = draw && scr.lit(displayX, displayY);
+
+      if (spanStart >= 0 && (!draw || lit != spanLit)) {
+        drawLEDSpan(spanStart, displayX - 1, displayY, spanLit);
+        PERF(ledPixels += displayX - spanStart);
+        PERF(ledSpans++);
+        spanStart = -1;
+      }
+      if (draw && spanStart < 0) {
+        spanStart = displayX;
+        spanLit = lit;
       }
     }
   }
@@ -491,80 +1493,60 @@ void refreshAll() {
   #if FAST_REFRESH
     firstRun = false;
   #endif
-}
 
-void invert() {
-  for (int i = 0; i < LINE_WIDTH * DISPLAY_ROWS; i++) {
-    scr[i] = ~scr[i];
-  }
+  PERF_RECORD(PERF_LED_PIXELS, ledPixels);
+  PERF_RECORD(PERF_LED_SPANS, ledSpans);
+
+  #if FRAMEBUFFER_RENDER
+    framebufferFlush();
+  #endif
+
+  publishFrame();
 }
 
+void invert() {
+  scr.invert();
+  layoutFace = -1;
+}
+
+// Shifts each LED row on its own, so nothing wraps from one row into another
 void scrollLeft() {
-  for (int i = 0; i < LINE_WIDTH * DISPLAY_ROWS - 1; i++) {
-    scr[i] = scr[i + 1];
-  }
-  scr[LINE_WIDTH * DISPLAY_ROWS - 1] = 0;
+  scr.scrollLeft();
+  layoutFace = -1;
 }
 
 // ======================== FONT HELPER FUNCTIONS ========================
 
-int charWidth(char c, const uint8_t* font) {
-  int firstChar = pgm_read_byte(font + 2);
-  int lastChar = pgm_read_byte(font + 3);
-  
-  if (c < firstChar || c > lastChar) return 0;
-  
-  int charIndex = c - firstChar;
-  int offset = 4;
-  for (int i = 0; i < charIndex; i++) {
-    int w = pgm_read_byte(font + offset);
-    offset += w * pgm_read_byte(font + 1) + 1;
-  }
-  
-  return pgm_read_byte(font + offset);
+int charWidth(char c, const Font& font) {
+  if (c < font.first || c > font.last) return 0;
+  return font.glyphs[c - font.first].width;
 }
 
-int drawCharWithY(int x, int yPos, char c, const uint8_t* font);
+int drawCharWithY(int x, int yPos, char c, const Font& font);
 
-int drawChar(int x, char c, const uint8_t* font) {
+int drawChar(int x, char c, const Font& font) {
   return drawCharWithY(x, 0, c, font);
 }
 
-int drawCharWithY(int x, int yPos, char c, const uint8_t* font) {
-  int fwd = pgm_read_byte(font);
-  int fht = pgm_read_byte(font + 1);
-  int offs = pgm_read_byte(font + 2);
-  int last = pgm_read_byte(font + 3);
-  
-  if (c < offs || c > last) return 0;
-  
-  c -= offs;
-  int fht8 = (fht + 7) / 8;
-  font += 4 + c * (fht8 * fwd + 1);
-  
-  int j, i, w = pgm_read_byte(font);
-  
-  for (j = 0; j < fht8; j++) {
-    for (i = 0; i < w; i++) {
-      if (x + i >= 0 && x + i < LINE_WIDTH) {
-        int bufferIndex = x + LINE_WIDTH * (j + yPos) + i;
-        if (bufferIndex >= 0 && bufferIndex < LINE_WIDTH * DISPLAY_ROWS) {
-          scr[bufferIndex] = pgm_read_byte(font + 1 + fht8 * i + j);
-        }
-      }
-    }
-    if (x + i < LINE_WIDTH && x + i >= 0) {
-      int bufferIndex = x + LINE_WIDTH * (j + yPos) + i;
-      if (bufferIndex >= 0 && bufferIndex < LINE_WIDTH * DISPLAY_ROWS) {
-        scr[bufferIndex] = 0;
-      }
-    }
+int drawCharWithY(int x, int yPos, char c, const Font& font) {
+  if (c < font.first || c > font.last) return 0;
+
+  int w = font.glyphs[c - font.first].width;
+  int glyphRows = font.rows * Matrix::BAND_HEIGHT;
+  const FontRow* rowBits = font.rowBits + (c - font.first) * glyphRows;
+  int y0 = yPos * Matrix::BAND_HEIGHT;
+
+  // Each pixel row is one masked write: the glyph columns plus a blank spacer
+  for (int r = 0; r < glyphRows; r++) {
+    int y = y0 + r;
+    if (y < 0 || y >= Matrix::HEIGHT) continue;
+    scr.writeRow(x, y, pgm_read_byte(rowBits + r), w + 1);
   }
   
   return w;
 }
 
-int stringWidth(const char* str, const uint8_t* font) {
+int stringWidth(const char* str, const Font& font) {
   int width = 0;
   while (*str) {
     width += charWidth(*str++, font) + 1;
@@ -572,13 +1554,20 @@ int stringWidth(const char* str, const uint8_t* font) {
   return width - 1;
 }
 
+void startMarquee(const char* msg, int width);
+
 void showMessage(const char* msg) {
   if (msg == NULL || strlen(msg) == 0) return;
 
   clearScreen();
-  delay(10);
 
   int width = stringWidth(msg, font3x7);
+  if (width > TOTAL_WIDTH) {
+    startMarquee(msg, width);  // Too long to fit: scroll it
+    refreshAll();
+    return;
+  }
+
   int x = (TOTAL_WIDTH - width) / 2;
 
   if (x < 0) x = 0;
@@ -588,7 +1577,6 @@ void showMessage(const char* msg) {
     x += drawChar(x, *msg++, font3x7) + 1;
   }
 
-  delay(10);
   refreshAll();
 }
 
@@ -596,7 +1584,6 @@ void showIPAddress(const char* ip) {
   if (ip == NULL || strlen(ip) == 0) return;
 
   clearScreen();
-  delay(10);
 
   // Split IP address at the second dot
   // Example: "192.168.1.123" -> "IP: 192.168." (top) and "1.123" (bottom)
@@ -631,14 +1618,93 @@ void showIPAddress(const char* ip) {
     }
   }
 
-  delay(10);
   refreshAll();
 }
 
+// ======================== GLYPH LAYOUT ========================
+// The clock faces describe what they show as a list of positioned glyphs.
+// The list drawn last is kept, so the next render only clears glyphs that
+// went away or moved and rasterizes the new ones; unchanged digits are
+// left alone and refreshAll() only visits the columns that were touched.
+
+#define LAYOUT_MAX_GLYPHS 32
+
+struct LayoutGlyph {
+  const Font* font;
+  int16_t x;
+  uint8_t row;
+  char c;
+};
+
+struct GlyphLayout {
+  int count;
+  LayoutGlyph glyphs[LAYOUT_MAX_GLYPHS];
+};
+
+GlyphLayout shownLayout = {};  // Glyphs on scr when layoutFace >= 0
+
+// Append text with one blank column between glyphs; returns the column after
+// the last glyph. Glyphs starting at or past maxStart are left out.
+int layoutText(GlyphLayout& layout, int x, int row, const char* text, const Font& font,
+               int maxStart = LINE_WIDTH) {
+  for (const char* p = text; *p; p++) {
+    if (x >= maxStart) break;
+    bool inFont = (*p >= font.first && *p <= font.last);
+    if (inFont && layout.count < LAYOUT_MAX_GLYPHS) {
+      LayoutGlyph& g = layout.glyphs[layout.count++];
+      g.font = &font;
+      g.x = x;
+      g.row = row;
+      g.c = *p;
+    }
+    x += charWidth(*p, font);
+    if (*(p + 1)) x++;
+  }
+  return x;
+}
+
+static bool layoutContains(const GlyphLayout& layout, const LayoutGlyph& g) {
+  for (int i = 0; i < layout.count; i++) {
+    const LayoutGlyph& o = layout.glyphs[i];
+    if (o.c == g.c && o.x == g.x && o.row == g.row && o.font == g.font) return true;
+  }
+  return false;
+}
+
+// Blank the columns a glyph covers, including its trailing spacer column
+static void clearGlyph(const LayoutGlyph& g) {
+  int columns = charWidth(g.c, *g.font) + 1;
+  int y0 = g.row * Matrix::BAND_HEIGHT;
+  int y1 = min(y0 + g.font->rows * Matrix::BAND_HEIGHT, (int)Matrix::HEIGHT);
+  for (int y = y0; y < y1; y++) {
+    scr.writeRow(g.x, y, 0, columns);
+  }
+}
+
+// Bring scr from the shown layout to next; a different face starts from blank
+void layoutCommit(int face, const GlyphLayout& next) {
+  if (layoutFace != face) {
+    clearScreen();
+    shownLayout.count = 0;
+  }
+
+  for (int i = 0; i < shownLayout.count; i++) {
+    if (!layoutContains(next, shownLayout.glyphs[i])) clearGlyph(shownLayout.glyphs[i]);
+  }
+  for (int i = 0; i < next.count; i++) {
+    const LayoutGlyph& g = next.glyphs[i];
+    if (!layoutContains(shownLayout, g)) drawCharWithY(g.x, g.row, g.c, *g.font);
+  }
+
+  shownLayout = next;
+  layoutFace = face;
+}
+
 // ======================== DISPLAY FUNCTIONS ========================
 
 void displayTimeAndTemp() {
-  clearScreen();
+  PERF_SCOPE(PERF_MODE_TIME_TEMP);
+  GlyphLayout next = {};
   
   char buf[32];
   bool showDots = (seconds % 2) == 0;
@@ -652,15 +1718,12 @@ void displayTimeAndTemp() {
   } else {
     sprintf(buf, "%d", displayHours);    // No leading zero
   }
-  for (const char* p = buf; *p; p++) {
-    x += drawCharWithY(x, 0, *p, font3x7);
-    if (*(p+1)) x++;
-  }
+  x = layoutText(next, x, 0, buf, font3x7);
 
   // Colon - Mode 0: flashing colon (one LED space before)
   x++;  // Space before colon
   if (showDots) {
-    x += drawCharWithY(x, 0, ':', font3x7);
+    x = layoutText(next, x, 0, ":", font3x7);
     x++;  // Space after colon
   } else {
     x += 2;  // When colon hidden, maintain spacing
@@ -668,10 +1731,7 @@ void displayTimeAndTemp() {
 
   // Minutes (using font3x7 to match temperature display size)
   sprintf(buf, "%02d", minutes);
-  for (const char* p = buf; *p; p++) {
-    x += drawCharWithY(x, 0, *p, font3x7);
-    if (*(p+1)) x++;
-  }
+  x = layoutText(next, x, 0, buf, font3x7);
   
   // AM/PM indicator (only in 12-hour mode)
   // In 12-hour mode, display AM or PM
@@ -682,12 +1742,7 @@ void displayTimeAndTemp() {
     const char* ampm = (hours24 >= 12) ? "PM" : "AM";
 
     x++;  // Space before AM/PM
-    for (const char* p = ampm; *p; p++) {
-      if (x < LINE_WIDTH) {
-        x += drawCharWithY(x, 0, *p, font3x7);
-        if (*(p+1) && x < LINE_WIDTH) x++;
-      }
-    }
+    x = layoutText(next, x, 0, ampm, font3x7);
   }
   // Note: Seconds are not displayed in Mode 0
   
@@ -700,17 +1755,14 @@ void displayTimeAndTemp() {
   } else {
     sprintf(buf, "NO SENSOR");
   }
-  
-  for (const char* p = buf; *p; p++) {
-    if (x < LINE_WIDTH - 3) {
-      x += drawCharWithY(x, 1, *p, font3x7);
-      if (*(p+1) && x < LINE_WIDTH) x++;
-    }
-  }
+  layoutText(next, x, 1, buf, font3x7, LINE_WIDTH - 3);
+
+  layoutCommit(0, next);
 }
 
 void displayTimeLarge() {
-  clearScreen();
+  PERF_SCOPE(PERF_MODE_TIME_LARGE);
+  GlyphLayout next = {};
   
   char buf[32];
   bool showDots = (seconds % 2) == 0;
@@ -724,15 +1776,12 @@ void displayTimeLarge() {
   } else {
     sprintf(buf, "%d", displayHours);    // No leading zero
   }
-  for (const char* p = buf; *p; p++) {
-    x += drawCharWithY(x, 0, *p, digits5x16rn);
-    if (*(p+1)) x++;
-  }
+  x = layoutText(next, x, 0, buf, digits5x16rn);
 
   // Draw colon - Mode 1: one LED space before and after the colon
   x++;  // Space before colon
   if (showDots) {
-    x += drawCharWithY(x, 0, ':', digits5x16rn);
+    x = layoutText(next, x, 0, ":", digits5x16rn);
     x++;  // Space after colon
   } else {
     x += 2;  // When colon is not shown, still maintain spacing
@@ -740,26 +1789,21 @@ void displayTimeLarge() {
 
   // Draw minutes
   sprintf(buf, "%02d", minutes);
-  for (const char* p = buf; *p; p++) {
-    x += drawCharWithY(x, 0, *p, digits5x16rn);
-    if (*(p+1)) x++;
-  }
+  x = layoutText(next, x, 0, buf, digits5x16rn);
 
   // Add seconds in small font
   // Note: May be truncated in 24-hour mode with hours >= 10 at larger LED sizes
   // Users can adjust LED Size or Spacing via web interface to fit all elements
   x++;
   sprintf(buf, "%02d", seconds);
-  for (const char* p = buf; *p; p++) {
-    if (x < LINE_WIDTH) {
-      x += drawCharWithY(x, 0, *p, font3x7);
-      if (*(p+1) && x < LINE_WIDTH) x++;
-    }
-  }
+  layoutText(next, x, 0, buf, font3x7);
+
+  layoutCommit(1, next);
 }
 
 void displayTimeAndDate() {
-  clearScreen();
+  PERF_SCOPE(PERF_MODE_TIME_DATE);
+  GlyphLayout next = {};
   
   char buf[32];
   bool showDots = (seconds % 2) == 0;
@@ -773,218 +1817,1166 @@ void displayTimeAndDate() {
   } else {
     sprintf(buf, "%d", displayHours);    // No leading zero
   }
-  for (const char* p = buf; *p; p++) {
-    x += drawCharWithY(x, 0, *p, digits5x8rn);
-    if (*(p+1)) x++;
-  }
+  x = layoutText(next, x, 0, buf, digits5x8rn);
 
   // Colon - Mode 2: one LED space before the colon
   x++;  // Space before colon
   if (showDots) {
-    x += drawCharWithY(x, 0, ':', digits5x8rn);
+    x = layoutText(next, x, 0, ":", digits5x8rn);
     x += 1;
   } else {
     x += 2;
   }
 
   sprintf(buf, "%02d", minutes);
-  for (const char* p = buf; *p; p++) {
-    x += drawCharWithY(x, 0, *p, digits5x8rn);
-    if (*(p+1)) x++;
-  }
+  x = layoutText(next, x, 0, buf, digits5x8rn);
 
   // Add seconds
   // Note: May be truncated in 24-hour mode with hours >= 10 at larger LED sizes
   // Users can adjust LED Size or Spacing via web interface to fit all elements
   x++;
   sprintf(buf, "%02d", seconds);
-  for (const char* p = buf; *p; p++) {
-    if (x < LINE_WIDTH) {
-      x += drawCharWithY(x, 0, *p, digits3x5);
-      if (*(p+1) && x < LINE_WIDTH) x++;
-    }
-  }
+  layoutText(next, x, 0, buf, digits3x5);
   
   // Bottom row: Date
   x = 2;
   formatDate(buf, sizeof(buf), day, month, year);
-  for (const char* p = buf; *p; p++) {
-    x += drawCharWithY(x, 1, *p, font3x7) + 1;
+  layoutText(next, x, 1, buf, font3x7);
+
+  layoutCommit(2, next);
+}
+
+// Night face: hours and minutes, steady colon, redrawn once a minute
+void displayTimeNight() {
+  GlyphLayout next = {};
+  char buf[8];
+  int displayHours = use24HourFormat ? hours24 : hours;
+  snprintf(buf, sizeof(buf), showLeadingZero ? "%02d:%02d" : "%d:%02d", displayHours, minutes);
+
+  int x = (TOTAL_WIDTH - stringWidth(buf, digits5x16rn)) / 2;
+  layoutText(next, x < 0 ? 0 : x, 0, buf, digits5x16rn);
+  layoutCommit(3, next);
+}
+
+// ======================== ANIMATION ========================
+// Message marquees and mode transitions run on the render task at
+// ANIMATION_FPS. Frames are placed by elapsed time, not frame count: a frame
+// that overruns its slot makes the following slots drop (and be counted)
+// while the animation still ends on time. The render loop handles the
+// seconds tick between frames, so animation never delays it.
+#define ANIMATION_FPS          40
+#define ANIMATION_FRAME_US     (1000000 / ANIMATION_FPS)
+#define MARQUEE_COLUMNS_PER_S  16    // Scroll speed of long messages
+#define MARQUEE_PAUSE_MS       1000  // Show the start of the text before each pass
+#define MARQUEE_GAP            8     // Blank columns before the text repeats
+#define MODE_TRANSITION        1     // 0 = snap, 1 = slide left, 2 = wipe down
+#define MODE_TRANSITION_MS     400
+
+enum AnimationType { ANIM_NONE, ANIM_MARQUEE, ANIM_SLIDE, ANIM_WIPE };
+
+struct Animation {
+  AnimationType type;
+  int64_t startUs;       // esp_timer time of the first frame
+  int64_t nextFrameUs;   // Deadline of the next frame
+  Matrix from;           // Transitions: outgoing and incoming faces
+  Matrix to;
+  char text[16];         // Marquee text and its width in columns
+  int textWidth;
+};
+
+Animation animation = {};
+std::atomic<uint32_t> animationFrames(0);
+std::atomic<uint32_t> animationFramesDropped(0);
+
+void startAnimation(AnimationType type) {
+  animation.type = type;
+  animation.startUs = esp_timer_get_time();
+  animation.nextFrameUs = animation.startUs + ANIMATION_FRAME_US;
+  if (renderTaskHandle) xTaskNotifyGive(renderTaskHandle);
+}
+
+// Snap a running transition to its incoming face; marquees keep going
+void finishTransition() {
+  if (animation.type == ANIM_SLIDE || animation.type == ANIM_WIPE) {
+    scr = animation.to;
+    animation.type = ANIM_NONE;
   }
 }
 
-// ======================== SENSOR FUNCTIONS ========================
+void stopAnimation() {
+  finishTransition();
+  animation.type = ANIM_NONE;
+}
 
-bool testSensor() {
-  Wire.begin(SDA_PIN, SCL_PIN);
+void drawMarqueeText(int x) {
+  for (const char* p = animation.text; *p && x < LINE_WIDTH; p++) {
+    x += drawChar(x, *p, font3x7) + 1;
+  }
+}
+
+void renderMarquee(int64_t elapsedUs) {
+  // Each pass: hold the start of the text, then scroll one full cycle
+  int cycle = animation.textWidth + MARQUEE_GAP;
+  int64_t pauseUs = MARQUEE_PAUSE_MS * 1000LL;
+  int64_t passUs = pauseUs + (int64_t)cycle * 1000000LL / MARQUEE_COLUMNS_PER_S;
+  int64_t t = elapsedUs % passUs;
+  int offset = (t < pauseUs) ? 0 : (int)((t - pauseUs) * MARQUEE_COLUMNS_PER_S / 1000000LL);
+
+  clearScreen();
+  drawMarqueeText(-offset);
+  drawMarqueeText(cycle - offset);  // Next copy coming in from the right
+}
+
+void startMarquee(const char* msg, int width) {
+  strncpy(animation.text, msg, sizeof(animation.text) - 1);
+  animation.text[sizeof(animation.text) - 1] = '\0';
+  animation.textWidth = width;
+  startAnimation(ANIM_MARQUEE);
+  renderMarquee(0);
+}
+
+void renderTransition(int64_t elapsedUs) {
+  int64_t durationUs = MODE_TRANSITION_MS * 1000LL;
+  if (elapsedUs >= durationUs) {
+    finishTransition();
+    return;
+  }
+
+  if (animation.type == ANIM_SLIDE) {
+    // Outgoing face moves left, the incoming one follows it in from the right
+    int offset = (int)(elapsedUs * LINE_WIDTH / durationUs);
+    for (int y = 0; y < TOTAL_HEIGHT; y++) {
+      for (int k = 0; k < Matrix::WORDS; k++) {
+        int x = k * 32 + offset;
+        scr.rows[y][k] = (animation.from.window(y, x) | animation.to.window(y, x - LINE_WIDTH)) &
+                         Matrix::wordMask(k);
+      }
+    }
+  } else {
+    // Incoming face replaces the outgoing one from the top down
+    int split = (int)(elapsedUs * TOTAL_HEIGHT / durationUs);
+    for (int y = 0; y < TOTAL_HEIGHT; y++) {
+      memcpy(scr.rows[y], (y < split ? animation.to : animation.from).rows[y], sizeof(scr.rows[y]));
+    }
+  }
+}
+
+// scr holds the new face and outgoing the previous one: animate between them
+void startTransition(const Matrix& outgoing) {
+#if MODE_TRANSITION
+  animation.from = outgoing;
+  animation.to = scr;
+  scr = outgoing;
+  startAnimation(MODE_TRANSITION == 2 ? ANIM_WIPE : ANIM_SLIDE);
+#endif
+}
+
+// Render task: draw the next frame if one is due
+void serviceAnimation() {
+  if (animation.type == ANIM_NONE) return;
+  int64_t now = esp_timer_get_time();
+  if (now < animation.nextFrameUs) return;
+
+  {
+    PERF_SCOPE(PERF_ANIMATION_FRAME);
+    int64_t elapsedUs = now - animation.startUs;
+    if (animation.type == ANIM_MARQUEE) {
+      renderMarquee(elapsedUs);
+    } else {
+      renderTransition(elapsedUs);
+    }
+    refreshAll();
+  }
+  animationFrames.fetch_add(1, std::memory_order_relaxed);
+
+  // Slots that passed while drawing are dropped, not replayed
+  int64_t after = esp_timer_get_time();
+  animation.nextFrameUs += ANIMATION_FRAME_US;
+  if (animation.nextFrameUs <= after) {
+    int64_t missed = (after - animation.nextFrameUs) / ANIMATION_FRAME_US + 1;
+    animation.nextFrameUs += missed * ANIMATION_FRAME_US;
+    animationFramesDropped.fetch_add((uint32_t)missed, std::memory_order_relaxed);
+  }
+}
+
+// How long the render task may sleep before the next frame is due
+TickType_t animationWaitTicks() {
+  if (animation.type == ANIM_NONE) return portMAX_DELAY;
+  int64_t remainingUs = animation.nextFrameUs - esp_timer_get_time();
+  if (remainingUs <= 0) return 0;
+  TickType_t ticks = pdMS_TO_TICKS((remainingUs + 999) / 1000);
+  return ticks > 0 ? ticks : 1;
+}
+
+// ======================== SENSOR HISTORY ========================
+// Trend data kept on the device: one-minute averages for a day and
+// quarter-hour averages for a month (~26 KB, statically allocated). Each
+// reading is averaged into the open minute; every closed minute is
+// averaged into the open quarter-hour. Served by /api/history.
+#define HISTORY_VERSION      1
+#define HISTORY_HEADER       12     // Bytes ahead of the samples in /api/history
+#define HISTORY_MINUTE_SLOTS 1440   // 24h of 1-minute slots
+#define HISTORY_QUARTER_SLOTS 2880  // 30 days of 15-minute slots
+
+HistoryTier<HISTORY_MINUTE_SLOTS> historyMinutes(60);
+HistoryTier<HISTORY_QUARTER_SLOTS> historyQuarters(15 * 60);
+
+// Network side: add one reading (NaN = not measured)
+void recordSensorHistory(float temp, float hum, float pres) {
+  time_t now = time(nullptr);
+  if (now < 24 * 3600) return;  // No timestamp to file it under
+
+  HistorySample closed;
+  uint32_t closedAt;
+  if (historyMinutes.add((uint32_t)now, historySample(temp, hum, pres), closed, closedAt)) {
+    HistorySample quarter;
+    uint32_t quarterAt;
+    historyQuarters.add(closedAt, closed, quarter, quarterAt);
+  }
+}
+
+// Stored slots of one tier that start within [from, to]:
+//   [0] version  [1] tier  [2..3] sample count  [4..7] period (s)
+//   [8..11] start time of the first sample (epoch s)
+//   [12..] per sample, oldest first: temp, hum, pres as int16
+// All little-endian; see sensor_history.h for units and HISTORY_NONE gaps.
+// The range is fixed when the request arrives (cursor: first slot number,
+// tier << 16 | sample count); the filler reads each slot by number, so one
+// that rolls out of the ring mid-response goes out as a gap.
+template <int N>
+size_t fillHistoryTier(const HistoryTier<N>& tier, uint8_t tierId, uint8_t* buf, size_t maxLen,
+                       size_t index, const HttpCursor& cursor) {
+  uint32_t count = cursor.arg & 0xFFFF;
+  uint32_t period = tier.period();
+  size_t len = 0;
+
+  if (index == 0) {
+    if (maxLen < HISTORY_HEADER) return HTTP_FILL_AGAIN;
+    uint32_t firstTime = count ? cursor.pos * period : 0;
+    buf[0] = HISTORY_VERSION;
+    buf[1] = tierId;
+    buf[2] = count & 0xFF;
+    buf[3] = count >> 8;
+    for (int i = 0; i < 4; i++) {
+      buf[4 + i] = (period >> (8 * i)) & 0xFF;
+      buf[8 + i] = (firstTime >> (8 * i)) & 0xFF;
+    }
+    len = HISTORY_HEADER;
+  }
+
+  NetworkLock lock;
+  uint32_t newestSlot = tier.newestTime() / period;
+  uint32_t k = (index + len - HISTORY_HEADER) / 6;  // Pieces are whole samples
+  for (; k < count && len + 6 <= maxLen; k++) {
+    uint32_t age = newestSlot - (cursor.pos + k);
+    HistorySample sample = {HISTORY_NONE, HISTORY_NONE, HISTORY_NONE};
+    if (age < (uint32_t)tier.size()) sample = tier.at(age);
+    int16_t values[3] = {sample.temp, sample.hum, sample.pres};
+    for (int v = 0; v < 3; v++) {
+      buf[len++] = (uint16_t)values[v] & 0xFF;
+      buf[len++] = (uint16_t)values[v] >> 8;
+    }
+  }
+  if (len == 0) return k < count ? HTTP_FILL_AGAIN : 0;
+  return len;
+}
 
-#ifdef USE_BME280
-  // Test BME280 sensor
-  if (!bme280.begin(0x76, &Wire)) {
-    DEBUG(Serial.println("BME280 sensor not found at 0x76"));
-    if (!bme280.begin(0x77, &Wire)) {
-      DEBUG(Serial.println("BME280 sensor not found at 0x77 either"));
-      return false;
+size_t fillHistory(uint8_t* buf, size_t maxLen, size_t index, HttpCursor& cursor) {
+  return (cursor.arg >> 16)
+      ? fillHistoryTier(historyQuarters, 1, buf, maxLen, index, cursor)
+      : fillHistoryTier(historyMinutes, 0, buf, maxLen, index, cursor);
+}
+
+template <int N>
+void sendHistory(HttpRequest& req, const HistoryTier<N>& tier, uint8_t tierId, uint32_t from, uint32_t to) {
+  int oldestAge = tier.size() - 1;
+  int newestAge = 0;
+  uint32_t period = tier.period();
+  uint32_t newestTime = tier.newestTime();
+
+  if (tier.size() == 0 || from > newestTime || to < tier.oldestTime()) {
+    oldestAge = -1;  // Nothing in range
+  } else {
+    if (from > tier.oldestTime()) oldestAge = (newestTime - from) / period;
+    if (to < newestTime) newestAge = (newestTime - to + period - 1) / period;
+  }
+  int count = (oldestAge >= newestAge) ? oldestAge - newestAge + 1 : 0;
+
+  HttpCursor cursor;
+  cursor.pos = count ? newestTime / period - oldestAge : 0;
+  cursor.arg = ((uint32_t)tierId << 16) | count;
+  req.sendHeader("Cache-Control", "no-cache");
+  req.sendBody<fillHistory>(200, "application/octet-stream", HISTORY_HEADER + count * 6, cursor);
+}
+
+// ======================== SENSOR FUNCTIONS ========================
+// All supported sensors are linked in; one bus scan at boot picks whichever
+// is fitted. Each driver is a probe (begin) and the two halves of an
+// asynchronous reading: a step starts a conversion and returns at once,
+// serviceSensor() collects the result once the datasheet conversion time
+// has passed, so the network task never waits on the sensor.
+#define SENSOR_DONE    -1
+#define SENSOR_FAILED  -2
+
+#define SENSOR_I2C_TIMEOUT_MS   20    // Upper bound on any one I2C transaction
+
+#define HTU21D_ADDRESS          0x40
+#define HTU21D_TEMP_NO_HOLD     0xF3  // Trigger temperature, no clock stretching
+#define HTU21D_HUMID_NO_HOLD    0xF5  // Trigger humidity, no clock stretching
+#define HTU21D_TEMP_MS          50    // 14-bit temperature, max conversion time
+#define HTU21D_HUMID_MS         16    // 12-bit humidity, max conversion time
+#define SHT3X_SINGLE_SHOT_HIGH  0x2400 // High repeatability, no clock stretching
+#define SHT3X_CONVERSION_MS     16
+
+struct SensorReading {
+  float temp;
+  float hum;
+  float pres;
+};
+
+struct SensorDriver {
+  const char* name;
+  const char* detail;            // Shown on the web page
+  bool hasPressure;
+  uint8_t addresses[2];          // Candidate I2C addresses (0 = unused)
+  bool (*begin)(uint8_t address);
+  // Starts conversion `step`; returns ms until its result can be collected,
+  // or SENSOR_FAILED if the sensor didn't acknowledge
+  int (*startStep)(uint8_t address, int step);
+  // Collects conversion `step`; returns the next step, SENSOR_DONE or SENSOR_FAILED
+  int (*collectStep)(uint8_t address, int step, SensorReading& reading);
+};
+
+// CRC-8, polynomial 0x31, as used by both HTU21D and SHT3x
+uint8_t sensorCRC8(const uint8_t* data, int len, uint8_t crc) {
+  for (int i = 0; i < len; i++) {
+    crc ^= data[i];
+    for (int bit = 0; bit < 8; bit++) {
+      crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x31) : (uint8_t)(crc << 1);
     }
   }
+  return crc;
+}
+
+bool sensorWriteCommand(uint8_t address, uint16_t command, int len) {
+  Wire.beginTransmission(address);
+  if (len == 2) Wire.write((uint8_t)(command >> 8));
+  Wire.write((uint8_t)command);
+  return Wire.endTransmission() == 0;
+}
+
+bool sensorReadBytes(uint8_t address, uint8_t* buf, int len) {
+  if (Wire.requestFrom(address, (uint8_t)len) != len) return false;
+  for (int i = 0; i < len; i++) buf[i] = Wire.read();
+  return true;
+}
 
-  bme280.setSampling(Adafruit_BME280::MODE_FORCED,
+// ---- BME280: free-running in normal mode, a reading is a register read ----
+bool bme280Begin(uint8_t address) {
+  if (!bme280.begin(address, &Wire)) return false;
+
+  // The sensor converts on its own once a second, so a reading never
+  // waits for a forced conversion
+  bme280.setSampling(Adafruit_BME280::MODE_NORMAL,
                      Adafruit_BME280::SAMPLING_X1,
                      Adafruit_BME280::SAMPLING_X1,
                      Adafruit_BME280::SAMPLING_X1,
-                     Adafruit_BME280::FILTER_OFF);
+                     Adafruit_BME280::FILTER_OFF,
+                     Adafruit_BME280::STANDBY_MS_1000);
+  return true;
+}
+
+int bme280StartStep(uint8_t address, int step) {
+  return 0;  // Results are already there
+}
 
-  float temp = bme280.readTemperature();
-  float hum = bme280.readHumidity();
+int bme280CollectStep(uint8_t address, int step, SensorReading& reading) {
+  reading.temp = bme280.readTemperature();
+  reading.hum = bme280.readHumidity();
+  reading.pres = bme280.readPressure() / 100.0F;
+  return SENSOR_DONE;
+}
 
-  if (isnan(temp) || isnan(hum) || temp < -50 || temp > 100 || hum < 0 || hum > 100) {
-    DEBUG(Serial.println("BME280 readings invalid"));
-    return false;
+// ---- SHT3x: one single-shot conversion for both values ----
+bool sht3xBegin(uint8_t address) {
+  return sht3x.begin(address);
+}
+
+int sht3xStartStep(uint8_t address, int step) {
+  return sensorWriteCommand(address, SHT3X_SINGLE_SHOT_HIGH, 2) ? SHT3X_CONVERSION_MS : SENSOR_FAILED;
+}
+
+int sht3xCollectStep(uint8_t address, int step, SensorReading& reading) {
+  uint8_t buf[6];
+  if (!sensorReadBytes(address, buf, sizeof(buf))) return SENSOR_FAILED;
+  if (sensorCRC8(buf, 2, 0xFF) != buf[2] || sensorCRC8(buf + 3, 2, 0xFF) != buf[5]) return SENSOR_FAILED;
+  reading.temp = -45.0f + 175.0f * (uint16_t)((buf[0] << 8) | buf[1]) / 65535.0f;
+  reading.hum = 100.0f * (uint16_t)((buf[3] << 8) | buf[4]) / 65535.0f;
+  return SENSOR_DONE;
+}
+
+// ---- HTU21D: temperature, then humidity, each a no-hold conversion ----
+bool htu21dBegin(uint8_t address) {
+  return htu21d.begin();  // Fixed address
+}
+
+int htu21dStartStep(uint8_t address, int step) {
+  uint8_t command = (step == 0) ? HTU21D_TEMP_NO_HOLD : HTU21D_HUMID_NO_HOLD;
+  if (!sensorWriteCommand(address, command, 1)) return SENSOR_FAILED;
+  return (step == 0) ? HTU21D_TEMP_MS : HTU21D_HUMID_MS;
+}
+
+int htu21dCollectStep(uint8_t address, int step, SensorReading& reading) {
+  uint8_t buf[3];
+  if (!sensorReadBytes(address, buf, sizeof(buf))) return SENSOR_FAILED;
+  if (sensorCRC8(buf, 2, 0x00) != buf[2]) return SENSOR_FAILED;
+  uint16_t raw = ((buf[0] << 8) | buf[1]) & 0xFFFC;  // Low two bits are status
+  if (step == 0) {
+    reading.temp = -46.85f + 175.72f * raw / 65536.0f;
+    return 1;
   }
+  reading.hum = -6.0f + 125.0f * raw / 65536.0f;
+  return SENSOR_DONE;
+}
 
-  DEBUG(Serial.printf("BME280 OK: %.1f°C, %.1f%%\n", temp, hum));
-  sensorType = "BME280";
-  return true;
+// In scan order; the first driver with an answering address wins
+const SensorDriver sensorDrivers[] = {
+  {"BME280", "Temp/Humid/Press, 0x76/77", true,  {0x76, 0x77},
+   bme280Begin, bme280StartStep, bme280CollectStep},
+  {"SHT3X",  "Temp/Humid, 0x44/45",       false, {0x44, 0x45},
+   sht3xBegin, sht3xStartStep, sht3xCollectStep},
+  {"HTU21D", "Temp/Humid, 0x40",          false, {HTU21D_ADDRESS, 0},
+   htu21dBegin, htu21dStartStep, htu21dCollectStep},
+};
+const int numSensorDrivers = sizeof(sensorDrivers) / sizeof(sensorDrivers[0]);
+
+const SensorDriver* activeSensor = nullptr;  // Set by detectSensor()
+
+// True if a device ACKs its address; an empty write, so it costs ~100us
+bool i2cDevicePresent(uint8_t address) {
+  Wire.beginTransmission(address);
+  return Wire.endTransmission() == 0;
+}
 
-#elif defined(USE_SHT3X)
-  // Test SHT3X sensor
-  if (!sht3x.begin(0x44)) {  // Default I2C address for SHT3X
-    DEBUG(Serial.println("SHT3X sensor not found at 0x44"));
-    if (!sht3x.begin(0x45)) {  // Alternative I2C address
-      DEBUG(Serial.println("SHT3X sensor not found at 0x45 either"));
-      return false;
+// One pass over the known sensor addresses, then begin() only on a device
+// that answered - missing sensors cost an address NACK, not a driver timeout
+bool detectSensor() {
+  Wire.begin(SDA_PIN, SCL_PIN);
+  Wire.setTimeOut(SENSOR_I2C_TIMEOUT_MS);
+
+  DEBUG(unsigned long scanStart = millis());  // Only reported in debug output
+  for (int i = 0; i < numSensorDrivers; i++) {
+    const SensorDriver& driver = sensorDrivers[i];
+    for (int a = 0; a < 2 && driver.addresses[a]; a++) {
+      uint8_t address = driver.addresses[a];
+      if (!i2cDevicePresent(address)) continue;
+
+      DEBUG(Serial.printf("I2C device at 0x%02X, trying %s\n", address, driver.name));
+      if (driver.begin(address)) {
+        activeSensor = &driver;
+        sensorType = driver.name;
+        sensorAddress = address;
+        DEBUG(Serial.printf("%s found at 0x%02X (scan took %lu ms)\n",
+                            driver.name, address, millis() - scanStart));
+        return true;
+      }
     }
   }
 
-  // Read initial values to verify sensor is working
-  float temp = sht3x.readTemperature();
-  float hum = sht3x.readHumidity();
+  DEBUG(Serial.printf("No sensor found (scan took %lu ms)\n", millis() - scanStart));
+  return false;
+}
 
-  if (isnan(temp) || isnan(hum) || temp < -50 || temp > 100 || hum < 0 || hum > 100) {
-    DEBUG(Serial.println("SHT3X readings invalid"));
-    return false;
+// ---- Asynchronous readings ----
+enum SensorPhase { SENSOR_IDLE, SENSOR_CONVERTING };
+
+struct SensorPipeline {
+  SensorPhase phase;
+  int step;                    // Conversion within the current reading
+  unsigned long readyAt;       // millis() when the conversion result is due
+  SensorReading reading;
+  uint32_t readCount;
+  uint32_t failCount;
+};
+
+SensorPipeline sensorPipeline = {};
+
+// Apply a finished reading, with the same validation as ever. The sensor is
+// only reported as available once it has produced a plausible reading.
+void publishSensorReading(const SensorReading& reading) {
+  bool tempValid = !isnan(reading.temp) && reading.temp >= -50 && reading.temp <= 100;
+  bool humValid = !isnan(reading.hum) && reading.hum >= 0 && reading.hum <= 100;
+  bool presValid = !isnan(reading.pres) && reading.pres >= 800 && reading.pres <= 1200;  // BME280 only
+
+  if (tempValid) {
+    displayState.temperature = (int)round(reading.temp);
+    displayState.sensorAvailable = true;
+  }
+  if (humValid) {
+    displayState.humidity = (int)round(reading.hum);
+  }
+  if (presValid) {
+    displayState.pressure = (int)round(reading.pres);
   }
 
-  DEBUG(Serial.printf("SHT3X OK: %.1f°C, %.1f%%\n", temp, hum));
-  sensorType = "SHT3X";
-  return true;
+  recordSensorHistory(tempValid ? reading.temp : NAN, humValid ? reading.hum : NAN,
+                      presValid ? reading.pres : NAN);
+  publishDisplayState();
+}
 
-#elif defined(USE_HTU21D)
-  // Test HTU21D sensor
-  if (!htu21d.begin()) {  // HTU21D uses fixed I2C address 0x40
-    DEBUG(Serial.println("HTU21D sensor not found at 0x40"));
-    return false;
+void beginSensorStep(int step) {
+  int waitMs = activeSensor->startStep(sensorAddress, step);
+  if (waitMs == SENSOR_FAILED) {
+    sensorPipeline.phase = SENSOR_IDLE;
+    sensorPipeline.failCount++;
+    DEBUG(Serial.printf("Sensor conversion %d not acknowledged\n", step));
+    return;
   }
+  sensorPipeline.step = step;
+  sensorPipeline.readyAt = millis() + waitMs;
+  sensorPipeline.phase = SENSOR_CONVERTING;
+}
 
-  // Read initial values to verify sensor is working
-  float temp = htu21d.readTemperature();
-  float hum = htu21d.readHumidity();
+// Network side: start a reading; the result is published by serviceSensor()
+void startSensorRead() {
+  if (!activeSensor || sensorPipeline.phase != SENSOR_IDLE) return;
+  PERF_SCOPE(PERF_SENSOR_STEP);
+  sensorPipeline.reading.temp = NAN;
+  sensorPipeline.reading.hum = NAN;
+  sensorPipeline.reading.pres = NAN;
+  beginSensorStep(0);
+}
 
-  if (isnan(temp) || isnan(hum) || temp < -50 || temp > 100 || hum < 0 || hum > 100) {
-    DEBUG(Serial.println("HTU21D readings invalid"));
-    return false;
+// Called from the network task; never blocks on a conversion. The pipeline
+// is the network task's own, so only publishing the reading takes the lock.
+void serviceSensor() {
+  if (sensorPipeline.phase != SENSOR_CONVERTING ||
+      (long)(millis() - sensorPipeline.readyAt) < 0) {
+    return;
   }
 
-  DEBUG(Serial.printf("HTU21D OK: %.1f°C, %.1f%%\n", temp, hum));
-  sensorType = "HTU21D";
-  return true;
+  PERF_SCOPE(PERF_SENSOR_STEP);
+  int next = activeSensor->collectStep(sensorAddress, sensorPipeline.step, sensorPipeline.reading);
+  if (next == SENSOR_DONE) {
+    sensorPipeline.phase = SENSOR_IDLE;
+    sensorPipeline.readCount++;
+    NetworkLock lock;
+    publishSensorReading(sensorPipeline.reading);
+  } else if (next == SENSOR_FAILED) {
+    // Keep the last good values; the next reading tries again
+    sensorPipeline.phase = SENSOR_IDLE;
+    sensorPipeline.failCount++;
+    DEBUG(Serial.printf("Sensor read failed (step %d)\n", sensorPipeline.step));
+  } else {
+    beginSensorStep(next);
+  }
+}
 
-#else
-  DEBUG(Serial.println("No sensor type defined in configuration"));
-  return false;
-#endif
+// ======================== SECONDS TICK ========================
+// One-shot esp_timer re-armed for each wall-clock second boundary (minute
+// boundary for the night face). The callback only sets a flag and wakes the
+// render task, which sleeps otherwise.
+
+esp_timer_handle_t secondTimer = nullptr;
+std::atomic<bool> secondTickPending(false);
+std::atomic<bool> minuteTicks(false);     // Set by the render task for the night face
+
+int64_t wallClockUs() {
+  struct timeval tv;
+  gettimeofday(&tv, nullptr);
+  return (int64_t)tv.tv_sec * 1000000LL + tv.tv_usec;
 }
 
-void updateSensorData() {
-  if (!sensorAvailable) return;
+// The last known time is kept in RTC memory, which survives software resets,
+// so after an OTA update, crash or restart the clock is right again before
+// WiFi is even up. NTP later corrects the second or so lost over the reset.
+#define RETAINED_CLOCK_MAGIC 0x434C4B31  // "CLK1"
 
-  float temp = NAN;
-  float hum = NAN;
-  float pres = NAN;
+struct RetainedClock {
+  uint32_t magic;
+  int64_t timeUs;   // Wall-clock time (us since epoch) at the last tick
+  uint32_t check;   // Guards against stale or half-written contents
+};
 
-#ifdef USE_BME280
-  // Read BME280 sensor
-  bme280.takeForcedMeasurement();
-  temp = bme280.readTemperature();
-  hum = bme280.readHumidity();
-  pres = bme280.readPressure() / 100.0F;
+RTC_NOINIT_ATTR RetainedClock retainedClock;
 
-#elif defined(USE_SHT3X)
-  // Read SHT3X sensor
-  temp = sht3x.readTemperature();
-  hum = sht3x.readHumidity();
-  // SHT3X doesn't have a pressure sensor, so pressure remains NAN
+uint32_t retainedClockCheck(int64_t timeUs) {
+  return RETAINED_CLOCK_MAGIC ^ (uint32_t)timeUs ^ (uint32_t)(timeUs >> 32);
+}
 
-#elif defined(USE_HTU21D)
-  // Read HTU21D sensor
-  temp = htu21d.readTemperature();
-  hum = htu21d.readHumidity();
-  // HTU21D doesn't have a pressure sensor, so pressure remains NAN
-#endif
+// Called every tick; only records a clock that has actually been set
+void saveRetainedClock() {
+  int64_t nowUs = wallClockUs();
+  if (nowUs < 24LL * 3600 * 1000000) return;
+  retainedClock.magic = 0;  // Invalid while being written
+  retainedClock.timeUs = nowUs;
+  retainedClock.check = retainedClockCheck(nowUs);
+  retainedClock.magic = RETAINED_CLOCK_MAGIC;
+}
 
-  // Update temperature if valid
-  if (!isnan(temp) && temp >= -50 && temp <= 100) {
-    temperature = (int)round(temp);
+// Boot: returns true if the system clock already holds a usable time,
+// setting it from RTC memory (plus the time since reset) if need be
+bool restoreRetainedClock() {
+  if (time(nullptr) >= 24 * 3600) return true;  // Kept running through the reset
+
+  // RTC memory is only trustworthy if power never went away
+  esp_reset_reason_t reason = esp_reset_reason();
+  bool warmReset = reason == ESP_RST_SW || reason == ESP_RST_PANIC || reason == ESP_RST_INT_WDT ||
+                   reason == ESP_RST_TASK_WDT || reason == ESP_RST_WDT;
+  if (!warmReset || retainedClock.magic != RETAINED_CLOCK_MAGIC ||
+      retainedClock.check != retainedClockCheck(retainedClock.timeUs)) {
+    return false;
   }
 
-  // Update humidity if valid
-  if (!isnan(hum) && hum >= 0 && hum <= 100) {
-    humidity = (int)round(hum);
-  }
+  int64_t nowUs = retainedClock.timeUs + esp_timer_get_time();
+  struct timeval tv;
+  tv.tv_sec = (time_t)(nowUs / 1000000LL);
+  tv.tv_usec = (suseconds_t)(nowUs % 1000000LL);
+  settimeofday(&tv, nullptr);
+  DEBUG(Serial.printf("Clock restored from RTC memory (reset reason %d)\n", (int)reason));
+  return true;
+}
 
-  // Update pressure if valid (only for BME280)
-  if (!isnan(pres) && pres >= 800 && pres <= 1200) {
-    pressure = (int)round(pres);
-  }
+void armSecondTick() {
+  if (!secondTimer) return;
+  int64_t periodUs = minuteTicks.load(std::memory_order_relaxed) ? 60000000LL : 1000000LL;
+  int64_t untilNext = periodUs - wallClockUs() % periodUs + SECOND_TICK_GUARD_US;
+  esp_timer_stop(secondTimer);  // Harmless if not running
+  esp_timer_start_once(secondTimer, (uint64_t)untilNext);
+}
+
+// Render task, on picking a tick up: how long after its due time that was
+// (timer dispatch, any light-sleep exit and the task switch)
+uint32_t tickLatencyUs() {
+  int64_t periodUs = minuteTicks.load(std::memory_order_relaxed) ? 60000000LL : 1000000LL;
+  int64_t late = wallClockUs() % periodUs - SECOND_TICK_GUARD_US;
+  return late > 0 ? (uint32_t)late : 0;
+}
+
+void onSecondTick(void* arg) {
+  secondTickPending.store(true, std::memory_order_release);
+  if (renderTaskHandle) xTaskNotifyGive(renderTaskHandle);
+  saveRetainedClock();
+  armSecondTick();
+}
+
+void startSecondTick() {
+  esp_timer_create_args_t args = {};
+  args.callback = onSecondTick;
+  args.name = "second";
+  esp_timer_create(&args, &secondTimer);
+  armSecondTick();
 }
 
 // ======================== NTP SYNC FUNCTION ========================
+// NTP runs in the background: startNTPSync() hands the request to SNTP and
+// returns at once, the SNTP callback records the server time, and
+// serviceNTP() evaluates it on the network task. The clock keeps ticking
+// from the RTC the whole time.
+#define NTP_TIMEOUT_MS 10000  // Give up on a sync request after 10s
+
+enum NtpState { NTP_IDLE, NTP_WAITING };
+
+struct NtpStatus {
+  NtpState state;
+  unsigned long requestedAt;     // millis() when the request was sent
+  int64_t requestUs;             // esp_timer time the request was sent
+  int64_t refUs;                 // esp_timer time of the last known clock reading
+  int64_t refTimeUs;             // Wall-clock time (us since epoch) at refUs
+  std::atomic<bool> resultReady; // Set by the SNTP callback
+  int64_t resultUs;              // esp_timer time the callback fired
+  int64_t resultTimeUs;          // Wall-clock time delivered by the server
+  bool synced;                   // At least one sync has completed
+  time_t lastSync;               // Epoch seconds of the last sync
+  long lastLatencyMs;            // Request to response time of the last sync
+  long lastOffsetMs;             // Correction applied to the local clock
+  uint32_t syncCount;
+  uint32_t failCount;
+};
+
+NtpStatus ntp;
+
+// SNTP callback (lwIP task): only record the result, serviceNTP() does the rest
+void onNTPTimeSync(struct timeval* tv) {
+  ntp.resultUs = esp_timer_get_time();
+  ntp.resultTimeUs = (int64_t)tv->tv_sec * 1000000LL + tv->tv_usec;
+  ntp.resultReady.store(true, std::memory_order_release);
+}
+
+// Switch the local timezone on the running clock; SNTP is left alone.
+// TZ is process-wide, so the render task's next localtime_r() sees it.
+void applyTimezone() {
+  setenv("TZ", timezones[currentTimezone].tzString, 1);
+  tzset();
+}
+
+bool fleetSkipsNTP();
 
-void syncNTP() {
+void startNTPSync() {
+  if (fleetSkipsNTP()) return;  // A fleet leader sets this clock
   DEBUG(Serial.println("Syncing time with NTP..."));
-  
+
+  // Remember where the free-running clock was so the correction can be measured
+  ntp.requestUs = esp_timer_get_time();
+  ntp.refUs = ntp.requestUs;
+  ntp.refTimeUs = wallClockUs();
+  ntp.requestedAt = millis();
+  ntp.state = NTP_WAITING;
+
   // ESP32 uses configTzTime instead of configTime with TZ string
+  sntp_set_time_sync_notification_cb(onNTPTimeSync);
   configTzTime(timezones[currentTimezone].tzString, "pool.ntp.org", "time.nist.gov");
-  
-  time_t now = time(nullptr);
-  int attempts = 0;
-  while (now < 24 * 3600 && attempts < 20) {
-    delay(500);
-    now = time(nullptr);
-    attempts++;
-  }
-  
-  if (now > 24 * 3600) {
+}
+
+// Called from the network task; never blocks
+void serviceNTP() {
+  if (ntp.resultReady.load(std::memory_order_acquire)) {
+    ntp.resultReady.store(false, std::memory_order_relaxed);
+
+    // Offset is only meaningful once the clock has been set before
+    int64_t expectedUs = ntp.refTimeUs + (ntp.resultUs - ntp.refUs);
+    ntp.lastOffsetMs = ntp.synced ? (long)((ntp.resultTimeUs - expectedUs) / 1000) : 0;
+    // SNTP also resyncs on its own; latency is only known for our requests
+    ntp.lastLatencyMs = (ntp.state == NTP_WAITING) ? (long)((ntp.resultUs - ntp.requestUs) / 1000) : 0;
+
+    ntp.refUs = ntp.resultUs;
+    ntp.refTimeUs = ntp.resultTimeUs;
+    ntp.lastSync = (time_t)(ntp.resultTimeUs / 1000000LL);
+    ntp.synced = true;
+    ntp.syncCount++;
+    ntp.state = NTP_IDLE;
+
+    time_t now = ntp.lastSync;
     struct tm timeinfo;
     localtime_r(&now, &timeinfo);
-    
-    hours = timeinfo.tm_hour % 12;
-    if (hours == 0) hours = 12;
-    hours24 = timeinfo.tm_hour;
-    minutes = timeinfo.tm_min;
-    seconds = timeinfo.tm_sec;
-    day = timeinfo.tm_mday;
-    month = timeinfo.tm_mon + 1;
-    year = timeinfo.tm_year + 1900;
-    
-    DEBUG(Serial.printf("Time synced: %02d:%02d:%02d %02d/%02d/%d (TZ: %s)\n",
-                        hours24, minutes, seconds, day, month, year,
-                        timezones[currentTimezone].name));
-    
+
+    // The render task picks the new time up on its next tick
+    DEBUG(Serial.printf("Time synced: %02d:%02d:%02d %02d/%02d/%d (TZ: %s) latency %ldms offset %ldms\n",
+                        timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec,
+                        timeinfo.tm_mday, timeinfo.tm_mon + 1, timeinfo.tm_year + 1900,
+                        timezones[currentTimezone].name, ntp.lastLatencyMs, ntp.lastOffsetMs));
+
+    // The clock may have stepped; line the tick up with the new second boundary
+    armSecondTick();
+
     // Flash green LED on successful sync
-    flashRGBLed(0, 1, 0);
-  } else {
+    pulseRGBLed(0, 1, 0);
+  }
+  else if (ntp.state == NTP_WAITING && millis() - ntp.requestedAt >= NTP_TIMEOUT_MS) {
+    ntp.state = NTP_IDLE;
+    ntp.failCount++;
     DEBUG(Serial.println("NTP sync failed"));
     // Flash red LED on failed sync
-    flashRGBLed(1, 0, 0);
+    pulseRGBLed(1, 0, 0);
+  }
+}
+
+// ======================== POWER ========================
+// Night mode trades detail for power. The backlight dims (LEDC PWM), the
+// face drops to hours and minutes and ticks once a minute, the CPU clock
+// comes down and WiFi sleeps through more DTIM beacons; the network task
+// polls less often too. It follows the schedule (nightStart..nightEnd,
+// local hours), the CYD's light sensor, or either, per nightTrigger.
+//
+// With a core built with CONFIG_PM_ENABLE, DFS runs all the time between
+// POWER_NIGHT_MHZ and the mode's ceiling, plus automatic light sleep with
+// POWER_LIGHT_SLEEP. The stock Arduino core has neither, so the clock is
+// set directly per mode.
+//
+// Nothing on the board measures current; /api/perf reports an estimate
+// from the model below next to the measured tick wake latency.
+#ifndef POWER_LIGHT_SLEEP
+  #define POWER_LIGHT_SLEEP 0  // Set to 1 to light-sleep when idle (CONFIG_PM_ENABLE only; LEDC stops while asleep, so the dimmed backlight flickers)
+#endif
+#define BACKLIGHT_LEDC_CHANNEL  0
+#define BACKLIGHT_PWM_HZ        5000
+#define BACKLIGHT_PWM_BITS      8
+#define BACKLIGHT_DAY_DUTY      255
+#define POWER_DAY_MHZ           240
+#define POWER_NIGHT_MHZ         80     // Lowest clock WiFi runs at
+#define POWER_CHECK_INTERVAL    1000
+#define POWER_NIGHT_POLL_MS     50     // Network task poll at night (OTA, blocking web server)
+#define LDR_DARK_LEVEL          400    // Smoothed LDR reading from which it counts as dark
+#define LDR_LIGHT_LEVEL         250    // ... and light again (hysteresis)
+
+// Current model (mA from the 5 V supply), for the estimate only
+#define POWER_MA_BOARD          15     // Regulator, USB-UART, TFT controller
+#define POWER_MA_CPU_AT_240     50     // Both cores, scales with the clock
+#define POWER_MA_BACKLIGHT      65     // Full duty
+#define POWER_MA_WIFI_NONE      95     // Receiver always on
+#define POWER_MA_WIFI_MIN       25     // Modem sleep, awake every DTIM
+#define POWER_MA_WIFI_MAX       12     // Modem sleep, awake every listen interval
+
+struct PowerState {
+  bool night;
+  bool pmActive;            // esp_pm is scaling the clock
+  int cpuMhz;               // Clock (or DFS ceiling) for the current mode
+  int backlightDuty;
+  int wifiPs;               // WIFI_PS_* in use
+  int ldrLevel;             // Smoothed light sensor reading, -1 before the first
+  bool dark;
+  uint32_t nightCount;      // Times night mode was entered
+  unsigned long changedAt;  // millis() of the last mode change
+};
+
+PowerState power = { false, false, POWER_DAY_MHZ, BACKLIGHT_DAY_DUTY, WIFI_PS_MIN_MODEM, -1, false, 0, 0 };
+
+// Boot (initTFT): backlight on through LEDC so it can be dimmed later
+void backlightBegin() {
+  ledcSetup(BACKLIGHT_LEDC_CHANNEL, BACKLIGHT_PWM_HZ, BACKLIGHT_PWM_BITS);
+  ledcAttachPin(TFT_BL_PIN, BACKLIGHT_LEDC_CHANNEL);
+  ledcWrite(BACKLIGHT_LEDC_CHANNEL, power.backlightDuty);
+}
+
+void setBacklight(int duty) {
+  power.backlightDuty = duty;
+  ledcWrite(BACKLIGHT_LEDC_CHANNEL, duty);
+}
+
+// Fleet followers need multicast on time; otherwise sleep more at night
+void applyWiFiSleep() {
+  power.wifiPs = fleetRole == FLEET_FOLLOWER ? WIFI_PS_NONE
+               : power.night ? WIFI_PS_MAX_MODEM : WIFI_PS_MIN_MODEM;
+  WiFi.setSleep((wifi_ps_type_t)power.wifiPs);
+}
+
+void applyCpuClock() {
+  int mhz = power.night ? POWER_NIGHT_MHZ : POWER_DAY_MHZ;
+  power.cpuMhz = mhz;
+#if CONFIG_PM_ENABLE
+  esp_pm_config_esp32_t pm = {};
+  pm.max_freq_mhz = mhz;
+  pm.min_freq_mhz = POWER_NIGHT_MHZ;
+  pm.light_sleep_enable = POWER_LIGHT_SLEEP;
+  power.pmActive = esp_pm_configure(&pm) == ESP_OK;
+  if (power.pmActive) return;
+#endif
+  if (getCpuFrequencyMhz() == (uint32_t)mhz) return;
+  setCpuFrequencyMhz(mhz);
+#if PERF_ENABLED
+  // Cycle counts taken at the old clock would now convert wrongly
+  for (int i = 0; i < PERF_PROBE_COUNT; i++) {
+    if (!perfProbeIsCount(i) && !perfProbeIsMicros(i)) perfStats[i].reset();
+  }
+#endif
+}
+
+void readAmbientLight() {
+  int raw = analogRead(LDR_PIN);
+  power.ldrLevel = power.ldrLevel < 0 ? raw : (power.ldrLevel * 7 + raw) / 8;
+  if (!power.dark && power.ldrLevel >= LDR_DARK_LEVEL) power.dark = true;
+  else if (power.dark && power.ldrLevel <= LDR_LIGHT_LEVEL) power.dark = false;
+}
+
+bool nightDue() {
+  if ((nightTrigger & NIGHT_AMBIENT) && power.dark) return true;
+  if (!(nightTrigger & NIGHT_SCHEDULE) || nightStart == nightEnd) return false;
+
+  time_t now = time(nullptr);
+  if (now < 24 * 3600) return false;  // No idea what hour it is yet
+  struct tm timeinfo;
+  localtime_r(&now, &timeinfo);
+  int h = timeinfo.tm_hour;
+  return nightStart < nightEnd ? (h >= nightStart && h < nightEnd)
+                               : (h >= nightStart || h < nightEnd);  // Across midnight
+}
+
+void setNightMode(bool night) {
+  power.night = night;
+  power.changedAt = millis();
+  if (night) power.nightCount++;
+
+  displayState.nightMode = night;
+  publishDisplayState();
+  setBacklight(night ? nightBrightness : BACKLIGHT_DAY_DUTY);
+  applyCpuClock();
+  applyWiFiSleep();
+  DEBUG(Serial.printf("Night mode %s: CPU %d MHz, backlight %d/255\n",
+                      night ? "on" : "off", power.cpuMhz, power.backlightDuty));
+}
+
+// Network timer (also run straight after a settings change)
+void powerTimer() {
+  NetworkLock lock;
+  if (nightTrigger & NIGHT_AMBIENT) readAmbientLight();
+  bool night = nightDue();
+  if (night != power.night) {
+    setNightMode(night);
+  } else if (night && power.backlightDuty != nightBrightness) {
+    setBacklight(nightBrightness);
   }
 }
 
+// Network task, after WiFi is up
+void powerBegin() {
+  applyCpuClock();
+  applyWiFiSleep();
+}
+
+uint32_t networkPollMs() {
+  return power.night ? POWER_NIGHT_POLL_MS : NETWORK_POLL_MS;
+}
+
+uint32_t estimatedCurrentMa() {
+  uint32_t wifi = power.wifiPs == WIFI_PS_NONE ? POWER_MA_WIFI_NONE
+                : power.wifiPs == WIFI_PS_MAX_MODEM ? POWER_MA_WIFI_MAX : POWER_MA_WIFI_MIN;
+  return POWER_MA_BOARD + POWER_MA_CPU_AT_240 * getCpuFrequencyMhz() / 240 +
+         POWER_MA_BACKLIGHT * power.backlightDuty / BACKLIGHT_DAY_DUTY + wifi;
+}
+
+// ======================== FLEET SYNC ========================
+// Clocks mounted together can share one time source. The leader syncs NTP
+// as usual and multicasts a beacon just after each second boundary: its
+// wall-clock time, its display mode and, with fleetMirror, its frame (also
+// sent whenever the frame changes). Followers skip NTP while beacons keep
+// coming and step their clock onto the leader's, and because the seconds
+// tick is armed from the wall clock their ticks and colons line up too.
+//
+// A beacon's transit time only ever makes the leader look behind, so a
+// follower takes the largest offset of FLEET_FILTER_SAMPLES beacons - the
+// one that waited least in the air and in the socket - as the true offset.
+// Followers also turn WiFi power save off, which would otherwise hold
+// multicast back until the AP's next DTIM beacon.
+#define FLEET_GROUP_ADDRESS     239, 255, 43, 21
+#define FLEET_PORT              43021
+#define FLEET_MAGIC             0x43594446  // "CYDF"
+#define FLEET_VERSION           1
+#define FLEET_FLAG_FRAME        0x01        // frame[] is present
+#define FLEET_LEADER_TIMEOUT_MS 5000        // Followers fall back to NTP after this long without a beacon
+#define FLEET_FILTER_SAMPLES    8           // Beacons per clock correction
+#define FLEET_DEADBAND_US       1000        // Offsets smaller than this are left alone
+#define FLEET_STEP_NOW_US       500000      // Offsets larger than this are corrected at once
+#define FLEET_MIRROR_TIMEOUT_MS 3000        // Followers draw their own face after this long without a frame
+
+struct __attribute__((packed)) FleetBeacon {
+  uint32_t magic;
+  uint8_t version;
+  uint8_t flags;                // FLEET_FLAG_*
+  uint8_t mode;                 // Leader's display mode
+  uint8_t secondsInMode;        // ... and its seconds into it
+  uint16_t modeSecond;          // ... as of this second (epoch seconds, low 16 bits)
+  uint32_t seq;
+  int64_t timeUs;               // Leader wall clock (us since epoch) when sent
+  uint8_t frame[Matrix::SIZE];  // Column (wire) layout, with FLEET_FLAG_FRAME
+};
+
+#define FLEET_HEADER_SIZE  offsetof(FleetBeacon, frame)
+
+struct FleetSync {
+  int role;                     // Role the socket is set up for
+  bool open;                    // Joined the group on the current connection
+  uint32_t seq;
+  time_t lastBeaconSecond;      // Leader: second the last beacon went out in
+  uint32_t lastFrameSeq;        // Leader: frame last sent
+  unsigned long listenSince;    // Follower: millis() the socket was opened
+  unsigned long lastBeaconAt;   // Follower: millis() the last beacon arrived
+  bool leaderPresent;           // Follower: beacons are arriving, NTP is off
+  bool ntpFallback;             // Follower: no leader, running its own NTP
+  int filterCount;
+  int64_t filterMaxUs;          // Largest offset of the current sample window
+  int64_t lastOffsetUs;         // Offset measured from the last beacon
+  int64_t lastCorrectionUs;     // Last step applied to the local clock
+  uint32_t beaconsSent;
+  uint32_t beaconsReceived;
+  uint32_t corrections;
+};
+
+FleetSync fleet = {};
+WiFiUDP fleetUdp;
+
+// Mode rotation as (second << 16) | (mode << 8) | secondsInMode, second as in modeSecond.
+// Render -> network on the leader; network -> render on a follower, 0 once adopted.
+std::atomic<uint32_t> faceMode(0);
+std::atomic<uint32_t> leaderMode(0);
+TripleBuffer<Matrix> mirrorChannel;
+
+bool fleetSkipsNTP() {
+  return fleetRole == FLEET_FOLLOWER && !fleet.ntpFallback;
+}
+
+// Move the local clock by offsetUs and re-align the seconds tick
+void fleetStepClock(int64_t offsetUs) {
+  int64_t nowUs = wallClockUs() + offsetUs;
+  struct timeval tv;
+  tv.tv_sec = (time_t)(nowUs / 1000000LL);
+  tv.tv_usec = (suseconds_t)(nowUs % 1000000LL);
+  settimeofday(&tv, nullptr);
+  armSecondTick();
+  fleet.lastCorrectionUs = offsetUs;
+  fleet.corrections++;
+}
+
+void fleetSend(bool withFrame) {
+  FleetBeacon b;
+  b.magic = FLEET_MAGIC;
+  b.version = FLEET_VERSION;
+  b.flags = withFrame ? FLEET_FLAG_FRAME : 0;
+  uint32_t mode = faceMode.load(std::memory_order_relaxed);
+  b.modeSecond = mode >> 16;
+  b.mode = (mode >> 8) & 0xFF;
+  b.secondsInMode = mode & 0xFF;
+  b.seq = ++fleet.seq;
+  if (withFrame) frameChannel.front().scr.toColumns(b.frame);
+  size_t len = withFrame ? sizeof(b) : FLEET_HEADER_SIZE;
+
+  fleetUdp.beginMulticastPacket();
+  b.timeUs = wallClockUs();  // Stamped as late as possible
+  fleetUdp.write((const uint8_t*)&b, len);
+  fleetUdp.endPacket();
+  fleet.beaconsSent++;
+}
+
+void fleetReceive(const FleetBeacon& b, int len, int64_t receivedUs) {
+  fleet.beaconsReceived++;
+  fleet.lastBeaconAt = millis();
+  if (!fleet.leaderPresent) {
+    fleet.leaderPresent = true;
+    fleet.ntpFallback = false;
+    fleet.filterCount = 0;
+    sntp_stop();  // In case the fallback started it
+    ntp.state = NTP_IDLE;
+    DEBUG(Serial.println("Fleet: following leader"));
+  }
+
+  // Way off (first beacon, leader stepped): correct now, else filter
+  int64_t offsetUs = b.timeUs - receivedUs;
+  fleet.lastOffsetUs = offsetUs;
+  if (offsetUs > FLEET_STEP_NOW_US || offsetUs < -FLEET_STEP_NOW_US) {
+    fleetStepClock(offsetUs);
+    fleet.filterCount = 0;
+  } else {
+    if (fleet.filterCount == 0 || offsetUs > fleet.filterMaxUs) fleet.filterMaxUs = offsetUs;
+    if (++fleet.filterCount >= FLEET_FILTER_SAMPLES) {
+      if (fleet.filterMaxUs > FLEET_DEADBAND_US || fleet.filterMaxUs < -FLEET_DEADBAND_US) {
+        fleetStepClock(fleet.filterMaxUs);
+      }
+      fleet.filterCount = 0;
+    }
+  }
+
+  leaderMode.store(((uint32_t)b.modeSecond << 16) | (b.mode << 8) | b.secondsInMode, std::memory_order_release);
+
+  if (fleetMirror && (b.flags & FLEET_FLAG_FRAME) && len == (int)sizeof(FleetBeacon)) {
+    mirrorChannel.back().fromColumns(b.frame);
+    mirrorChannel.publish();
+    if (renderTaskHandle) xTaskNotifyGive(renderTaskHandle);
+  }
+}
+
+// Set up for a new role (or a new connection); false if the group can't be joined
+bool fleetOpen() {
+  fleetUdp.stop();
+  fleet.open = false;
+  fleet.leaderPresent = false;
+  applyWiFiSleep();
+  if (fleet.role == FLEET_STANDALONE) return true;
+
+  if (!fleetUdp.beginMulticast(IPAddress(FLEET_GROUP_ADDRESS), FLEET_PORT)) return false;
+  fleet.open = true;
+  fleet.listenSince = millis();
+  DEBUG(Serial.printf("Fleet: %s on port %d\n", fleet.role == FLEET_LEADER ? "leading" : "listening", FLEET_PORT));
+  return true;
+}
+
+// Network task, every pass
+void serviceFleet() {
+  if (fleet.role != fleetRole) {
+    bool wasSkippingNTP = fleet.role == FLEET_FOLLOWER && !fleet.ntpFallback;
+    fleet.role = fleetRole;
+    fleet.ntpFallback = false;
+    fleetOpen();
+    if (wasSkippingNTP) startNTPSync();  // No longer following: sync ourselves
+  }
+  if (fleet.role == FLEET_STANDALONE) return;
+
+  // The group membership goes with the connection
+  if (WiFi.status() != WL_CONNECTED) {
+    if (fleet.open) fleetUdp.stop();
+    fleet.open = false;
+    return;
+  }
+  if (!fleet.open && !fleetOpen()) return;
+
+  // Drain the socket; a leader also hears its own beacons and ignores them
+  int len;
+  while ((len = fleetUdp.parsePacket()) > 0) {
+    int64_t receivedUs = wallClockUs();
+    FleetBeacon b;
+    int n = fleetUdp.read((uint8_t*)&b, sizeof(b));
+    if (fleet.role != FLEET_FOLLOWER || n < (int)FLEET_HEADER_SIZE ||
+        b.magic != FLEET_MAGIC || b.version != FLEET_VERSION) {
+      continue;
+    }
+    fleetReceive(b, n, receivedUs);
+  }
+
+  if (fleet.role == FLEET_LEADER) {
+    time_t now = time(nullptr);
+    if (now < 24 * 3600) return;  // Nothing worth sharing yet
+    bool newSecond = now != fleet.lastBeaconSecond;
+    bool newFrame = fleetMirror && frameChannel.front().seq != fleet.lastFrameSeq;
+    if (newSecond || newFrame) {
+      fleetSend(fleetMirror);
+      fleet.lastBeaconSecond = now;
+      fleet.lastFrameSeq = frameChannel.front().seq;
+    }
+    return;
+  }
+
+  // Follower without a leader: keep time with NTP until one turns up
+  unsigned long heardAt = fleet.leaderPresent ? fleet.lastBeaconAt : fleet.listenSince;
+  if (!fleet.ntpFallback && millis() - heardAt >= FLEET_LEADER_TIMEOUT_MS) {
+    fleet.leaderPresent = false;
+    fleet.ntpFallback = true;
+    DEBUG(Serial.println("Fleet: no leader, using NTP"));
+    startNTPSync();
+  }
+}
+
+// Render side: leader publishes its mode after each tick
+void publishFaceMode() {
+  uint32_t second = (uint16_t)time(nullptr);
+  faceMode.store((second << 16) | (currentMode << 8) | secondsInMode, std::memory_order_relaxed);
+}
+
+// Render side: follower takes the leader's mode rotation before its own tick,
+// brought forward to the second before this one
+void adoptLeaderMode() {
+  uint32_t mode = leaderMode.exchange(0, std::memory_order_acquire);
+  if (mode == 0) return;
+  int leaderFace = (mode >> 8) & 0xFF;
+  uint16_t behind = (uint16_t)time(nullptr) - (uint16_t)(mode >> 16) - 1;
+  if (leaderFace >= 3 || behind > 2) return;  // Bad or stale
+  currentMode = leaderFace;
+  secondsInMode = (mode & 0xFF) + behind;
+}
+
+// Render side: show the leader's frame on a mirroring follower
+bool mirroring = false;
+unsigned long mirrorShownAt = 0;
+
+void serviceMirror() {
+  if (!mirrorChannel.update()) return;
+  mirroring = true;
+  mirrorShownAt = millis();
+  if (messageHeld) return;
+  stopAnimation();
+  scr = mirrorChannel.front();
+  layoutFace = -1;  // Our own face starts from blank when mirroring ends
+  refreshAll();
+}
+
+bool mirrorActive() {
+  if (mirroring && millis() - mirrorShownAt >= FLEET_MIRROR_TIMEOUT_MS) mirroring = false;
+  return mirroring;
+}
+
 // ======================== TIME UPDATE FUNCTION ========================
 
-void updateTime() {
+// Load the time fields from the system clock; false until it has been set
+bool readLocalTime() {
   time_t now = time(nullptr);
-  if (now < 24 * 3600) return;
+  if (now < 24 * 3600) return false;
   
   struct tm timeinfo;
   localtime_r(&now, &timeinfo);
@@ -997,9 +2989,45 @@ void updateTime() {
   day = timeinfo.tm_mday;
   month = timeinfo.tm_mon + 1;
   year = timeinfo.tm_year + 1900;
+  return true;
+}
+
+void updateTime() {
+  if (!readLocalTime()) return;
   
-  if (seconds != lastSecond) {
-    lastSecond = seconds;
+  // The night face only changes once a minute
+  int tick = nightFace ? minutes : seconds;
+  if (tick != lastSecond) {
+    PERF_SCOPE(PERF_UPDATE_TIME);
+    lastSecond = tick;
+
+    // Leave an overlay message up until its hold time has passed
+    if (messageHeld) {
+      if (messageHoldMs == 0 || millis() - messageShownAt < messageHoldMs) return;
+      messageHeld = false;
+    }
+
+    // A mirroring follower shows the leader's frames instead
+    if (mirrorActive()) return;
+
+    // A marquee ends with its message; a transition jumps to its last frame
+    stopAnimation();
+
+    if (nightFace) {
+      displayTimeNight();
+      refreshAll();
+      return;
+    }
+
+    // Auto-switch modes (using user-configurable interval)
+    adoptLeaderMode();
+    bool modeChanged = false;
+    if (++secondsInMode > modeSwitchInterval) {
+      currentMode = (currentMode + 1) % 3;
+      secondsInMode = 1;
+      modeChanged = true;
+    }
+    Matrix outgoing = scr;
 
     // Show what's being displayed in current mode
     if (currentMode == 0) {
@@ -1031,683 +3059,1220 @@ void updateTime() {
         displayHours, minutes, seconds, day, month, year));
     }
 
-    switch (currentMode) {
-      case 0: displayTimeAndTemp(); break;
-      case 1: displayTimeLarge(); break;
-      case 2: displayTimeAndDate(); break;
+    switch (currentMode) {
+      case 0: displayTimeAndTemp(); break;
+      case 1: displayTimeLarge(); break;
+      case 2: displayTimeAndDate(); break;
+    }
+    if (modeChanged) {
+      startTransition(outgoing);
+    }
+    refreshAll();
+    publishFaceMode();
+  }
+}
+
+// ======================== RENDER STATE ========================
+
+void renderCurrentMode() {
+  if (nightFace) {
+    displayTimeNight();
+    return;
+  }
+  switch (currentMode) {
+    case 0: displayTimeAndTemp(); break;
+    case 1: displayTimeLarge(); break;
+    case 2: displayTimeAndDate(); break;
+  }
+}
+
+// Render side: adopt a snapshot published by the network task
+void applyDisplayState(const DisplayState& state) {
+  static uint32_t lastRedrawSeq = 0;
+  static uint32_t lastMessageSeq = 0;
+  static uint32_t lastClockSeq = 0;
+
+  sensorAvailable = state.sensorAvailable;
+  temperature = state.temperature;
+  humidity = state.humidity;
+  pressure = state.pressure;
+  useFahrenheit = state.useFahrenheit;
+  use24HourFormat = state.use24HourFormat;
+  showLeadingZero = state.showLeadingZero;
+  dateFormat = state.dateFormat;
+  modeSwitchInterval = state.modeSwitchInterval;
+  displayStyle = state.displayStyle;
+  ledOnColor = state.ledOnColor;
+  ledSurroundColor = state.ledSurroundColor;
+  ledOffColor = state.ledOffColor;
+  ledSize = state.ledSize;
+  ledSpacing = state.ledSpacing;
+
+  bool rotationChanged = (displayRotation != state.displayRotation);
+  displayRotation = state.displayRotation;
+
+  bool redraw = state.redrawSeq != lastRedrawSeq || rotationChanged;
+
+  // Into or out of night mode: change the tick rate and the face now
+  if (state.nightMode != nightFace) {
+    nightFace = state.nightMode;
+    minuteTicks.store(nightFace, std::memory_order_relaxed);
+    armSecondTick();
+    if (!redraw && !messageHeld) {
+      lastSecond = -1;
+      updateTime();
+    }
+  }
+
+  // Local time jumped: show it now instead of at the next tick
+  if (state.clockSeq != lastClockSeq) {
+    lastClockSeq = state.clockSeq;
+    if (readLocalTime() && !redraw && !messageHeld) {
+      finishTransition();
+      renderCurrentMode();
+      refreshAll();
+    }
+  }
+
+  if (redraw) {
+    lastRedrawSeq = state.redrawSeq;
+
+    waitForDisplayIdle();
+    if (rotationChanged) {
+      tft.setRotation(displayRotation);
+    }
+    tft.fillScreen(BG_COLOR);
+    forceFullRedraw = true;
+
+    // Re-place the LEDs and rebuild their bitmaps if size, spacing or colors changed
+    updateLedLayout();
+#if FRAMEBUFFER_RENDER
+    framebufferBegin();  // Bands follow the layout
+#endif
+
+    if (!messageHeld) {
+      finishTransition();
+      renderCurrentMode();
+    }
+    refreshAll();
+  }
+
+  if (state.messageSeq != lastMessageSeq) {
+    lastMessageSeq = state.messageSeq;
+    messageHeld = true;
+    messageShownAt = millis();
+    messageHoldMs = state.messageHoldMs;
+    stopAnimation();
+    if (state.messageIsAddress) {
+      showIPAddress(state.message);
+    } else {
+      showMessage(state.message);
+    }
+  }
+}
+
+// ======================== DISPLAY EVENTS ========================
+// /api/events is a Server-Sent Events stream so the web page doesn't have to poll:
+//   event: frame  data: seq,style,ledColor,surroundColor,<column bytes as hex>
+//   event: diff   data: seq,baseSeq,<iivv hex pairs for each changed column byte>
+//   event: time   data: same JSON as /api/time, once per second
+// Every message is serialized once into events.buf and written to all subscribers.
+// Runs on the network task. With ASYNC_WEB_SERVER the streams belong to
+// eventSource, which queues each message per client; otherwise subscribers
+// are plain sockets kept from server.client(). Messages are formatted under
+// the network lock and sent after it is released.
+
+#define SSE_MAX_CLIENTS   4
+#define SSE_BUFFER_SIZE   (Matrix::SIZE * 4 + 64)  // Diff touching every byte
+static_assert(Matrix::SIZE <= 256, "diff events address column bytes with two hex digits");
+
+struct EventStream {
+#if ASYNC_WEB_SERVER
+  std::atomic<bool> keyframeDue;  // A stream connected since the last frame event
+#else
+  WiFiClient clients[SSE_MAX_CLIENTS];
+#endif
+  FrameSnapshot sent;            // Last frame broadcast, base for the next diff
+  time_t lastTime;               // Last second pushed (doubles as keep-alive)
+  char buf[SSE_BUFFER_SIZE];
+};
+
+EventStream events;
+std::atomic<int> eventClients(0);  // Subscribers as of the last serviceEvents(), for /metrics
+
+static const char hexDigits[] = "0123456789abcdef";
+
+static int appendHex(char* out, uint8_t value) {
+  out[0] = hexDigits[value >> 4];
+  out[1] = hexDigits[value & 0x0F];
+  return 2;
+}
+
+// Shared by /api/time and the time event
+int formatTimeJson(char* out, size_t size) {
+  time_t now = time(nullptr);
+  struct tm timeinfo;
+  localtime_r(&now, &timeinfo);
+
+  return snprintf(out, size,
+                  "{\"hours\":%d,\"minutes\":%d,\"seconds\":%d,\"day\":%d,\"month\":%d,\"year\":%d,"
+                  "\"use24hour\":%s,\"dateFormat\":%d,"
+                  "\"ntp\":{\"synced\":%s,\"lastSync\":%lu,\"latencyMs\":%ld,\"offsetMs\":%ld,"
+                  "\"syncCount\":%lu,\"failCount\":%lu}}",
+                  timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec,
+                  timeinfo.tm_mday, timeinfo.tm_mon + 1, timeinfo.tm_year + 1900,
+                  displayState.use24HourFormat ? "true" : "false", displayState.dateFormat,
+                  ntp.synced ? "true" : "false", (unsigned long)ntp.lastSync,
+                  ntp.lastLatencyMs, ntp.lastOffsetMs,
+                  (unsigned long)ntp.syncCount, (unsigned long)ntp.failCount);
+}
+
+int formatFrameEvent(char* out, size_t size, const FrameSnapshot& frame) {
+  int len = snprintf(out, size, "event: frame\ndata: %lu,%d,%u,%u,",
+                     (unsigned long)frame.seq, frame.displayStyle,
+                     frame.ledOnColor, frame.ledSurroundColor);
+  for (int i = 0; i < Matrix::SIZE; i++) {
+    len += appendHex(out + len, frame.scr.columnByte(i));
+  }
+  out[len++] = '\n';
+  out[len++] = '\n';
+  return len;
+}
+
+int formatDiffEvent(char* out, size_t size, const FrameSnapshot& base, const FrameSnapshot& frame) {
+  int len = snprintf(out, size, "event: diff\ndata: %lu,%lu,",
+                     (unsigned long)frame.seq, (unsigned long)base.seq);
+  for (int i = 0; i < Matrix::SIZE; i++) {
+    uint8_t value = frame.scr.columnByte(i);
+    if (value != base.scr.columnByte(i)) {
+      len += appendHex(out + len, i);
+      len += appendHex(out + len, value);
+    }
+  }
+  out[len++] = '\n';
+  out[len++] = '\n';
+  return len;
+}
+
+#if ASYNC_WEB_SERVER
+// events.buf holds "event: <name>\ndata: <payload>\n\n"; AsyncEventSource
+// writes that framing itself, so cut the two fields out in place
+static bool splitEvent(int len, const char*& name, const char*& data) {
+  char* nameEnd = (char*)memchr(events.buf, '\n', len);
+  if (nameEnd == nullptr || len < (nameEnd - events.buf) + 9) return false;
+  *nameEnd = '\0';
+  events.buf[len - 2] = '\0';
+  name = events.buf + 7;   // After "event: "
+  data = nameEnd + 7;      // After "\ndata: "
+  return true;
+}
+
+int countEventClients() {
+  return eventSource.count();
+}
+
+void broadcastEvent(int len) {
+  const char* name;
+  const char* data;
+  if (splitEvent(len, name, data)) eventSource.send(data, name);
+}
+
+// Network side: whether a new stream is waiting for its keyframe
+bool takeKeyframeDue() {
+  return events.keyframeDue.exchange(false);
+}
+
+// New /api/events stream (AsyncTCP task, inside eventSource's own lock, so
+// the network lock is not taken here). The next serviceEvents() pass sends
+// every stream a frame event for it; the page ignores diffs until then.
+void handleEventsConnect(AsyncEventSourceClient* client) {
+  httpRequests++;
+  if (countEventClients() > SSE_MAX_CLIENTS) {
+    client->close();
+    return;
+  }
+  events.keyframeDue = true;
+  DEBUG(Serial.printf("Event client subscribed (%d active)\n", countEventClients()));
+}
+#else
+int countEventClients() {
+  int count = 0;
+  for (int i = 0; i < SSE_MAX_CLIENTS; i++) {
+    if (events.clients[i].connected()) count++;
+  }
+  return count;
+}
+
+// Write events.buf to every subscriber, dropping any that can't keep up
+void broadcastEvent(int len) {
+  for (int i = 0; i < SSE_MAX_CLIENTS; i++) {
+    WiFiClient& client = events.clients[i];
+    if (!client.connected()) continue;
+    if (client.write((const uint8_t*)events.buf, len) != (size_t)len) {
+      DEBUG(Serial.printf("Event client %d dropped\n", i));
+      client.stop();
+    }
+  }
+}
+
+// /api/events handler: take over the socket and send a keyframe
+void handleEventsSubscribe(HttpRequest& req) {
+  int slot = -1;
+  for (int i = 0; i < SSE_MAX_CLIENTS; i++) {
+    if (!events.clients[i].connected()) {
+      slot = i;
+      break;
+    }
+  }
+  if (slot < 0) {
+    req.send(503, "text/plain", "Too many event clients");
+    return;
+  }
+
+  // Headers are written by hand; the WebServer lets go of its copy of the
+  // socket once the handler returns and the connection lives on here.
+  WiFiClient client = server.client();
+  client.print("HTTP/1.1 200 OK\r\n"
+               "Content-Type: text/event-stream\r\n"
+               "Cache-Control: no-cache\r\n"
+               "Connection: keep-alive\r\n\r\n"
+               "retry: 2000\n\n");
+
+  // Keyframe is the last broadcast frame so the next diff applies cleanly
+  int len = formatFrameEvent(events.buf, sizeof(events.buf), events.sent);
+  client.write((const uint8_t*)events.buf, len);
+  events.clients[slot] = client;
+  DEBUG(Serial.printf("Event client %d subscribed (%d active)\n", slot, countEventClients()));
+}
+
+// Subscribers get their keyframe as they are accepted
+bool takeKeyframeDue() {
+  return false;
+}
+
+#endif
+
+// Network task, outside the network lock: push frame changes and the time
+void serviceEvents() {
+  int clients = countEventClients();
+  eventClients.store(clients, std::memory_order_relaxed);
+  bool keyframe = takeKeyframeDue();
+
+  int len = 0;
+  {
+    NetworkLock lock;  // frameChannel's reader side is shared with the handlers
+    frameChannel.update();
+    const FrameSnapshot& frame = frameChannel.front();
+    if (frame.seq != events.sent.seq || keyframe) {
+      if (clients > 0) {
+        bool sameLook = frame.displayStyle == events.sent.displayStyle &&
+                        frame.ledOnColor == events.sent.ledOnColor &&
+                        frame.ledSurroundColor == events.sent.ledSurroundColor;
+        len = (sameLook && !keyframe) ? formatDiffEvent(events.buf, sizeof(events.buf), events.sent, frame)
+                                      : formatFrameEvent(events.buf, sizeof(events.buf), frame);
+      }
+      events.sent = frame;
+    }
+  }
+  if (len > 0) broadcastEvent(len);
+
+  if (clients == 0) return;
+
+  time_t now = time(nullptr);
+  if (now != events.lastTime) {
+    events.lastTime = now;
+    {
+      NetworkLock lock;
+      len = snprintf(events.buf, sizeof(events.buf), "event: time\ndata: ");
+      len += formatTimeJson(events.buf + len, sizeof(events.buf) - len - 2);
+    }
+    events.buf[len++] = '\n';
+    events.buf[len++] = '\n';
+    broadcastEvent(len);
+  }
+}
+
+// ======================== WIFI LINK ========================
+// Keeps the station connected without blocking or rebooting. WiFi events
+// (on the WiFi event task) only record what happened; serviceWiFi() on the
+// network task acts on it. After a drop, reconnect attempts back off
+// exponentially from WIFI_BACKOFF_MIN_MS to WIFI_BACKOFF_MAX_MS, each wait
+// jittered to 50-100% so clocks sharing an AP don't retry in lockstep.
+// The clock keeps running from the RTC while offline.
+#define WIFI_BACKOFF_MIN_MS      1000
+#define WIFI_BACKOFF_MAX_MS      60000
+#define WIFI_ATTEMPT_TIMEOUT_MS  10000  // Abandon an attempt that hasn't connected by then
+
+enum WiFiLinkState {
+  WIFI_LINK_UP,          // Associated with an address
+  WIFI_LINK_WAITING,     // Backing off before the next attempt
+  WIFI_LINK_CONNECTING   // Attempt in progress
+};
+
+struct WiFiLink {
+  WiFiLinkState state;
+  uint32_t backoffMs;        // Un-jittered wait before the next attempt
+  uint32_t nextAttemptAt;    // millis() the wait ends (WAITING)
+  uint32_t attemptStartedAt; // millis() the attempt began (CONNECTING)
+  uint32_t downSince;        // millis() the link dropped
+  uint32_t attempts;         // Reconnect attempts started
+  uint32_t disconnects;      // Drops of an established link
+  uint64_t offlineMs;        // Total length of completed outages
+  uint32_t lastOutageMs;     // Length of the most recent completed outage
+  uint8_t lastReason;        // Driver reason code of the last disconnect
+};
+
+WiFiLink wifiLink = { WIFI_LINK_UP, WIFI_BACKOFF_MIN_MS, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+// Set by onWiFiEvent(), consumed by serviceWiFi()
+std::atomic<bool> wifiDropped(false);
+std::atomic<bool> wifiGotIP(false);
+std::atomic<uint8_t> wifiDropReason(0);
+
+void onWiFiEvent(arduino_event_id_t event, arduino_event_info_t info) {
+  if (event == ARDUINO_EVENT_WIFI_STA_DISCONNECTED) {
+    wifiDropReason.store(info.wifi_sta_disconnected.reason, std::memory_order_relaxed);
+    wifiDropped.store(true, std::memory_order_release);
+  } else if (event == ARDUINO_EVENT_WIFI_STA_GOT_IP) {
+    wifiGotIP.store(true, std::memory_order_release);
+  }
+}
+
+// Take over from the driver once the first connection is up (end of bring-up)
+void startWiFiSupervision() {
+  WiFi.setAutoReconnect(false);  // Retries are ours, with backoff
+  WiFi.onEvent(onWiFiEvent);
+  wifiDropped.store(false);
+  wifiGotIP.store(false);
+  wifiLink.state = WIFI_LINK_UP;
+}
+
+// Wait backoffMs (jittered), then try again; the next wait is twice as long
+void scheduleReconnect(uint32_t now) {
+  uint32_t half = wifiLink.backoffMs / 2;
+  wifiLink.nextAttemptAt = now + half + (uint32_t)random(half + 1);
+  wifiLink.backoffMs = min(wifiLink.backoffMs * 2, (uint32_t)WIFI_BACKOFF_MAX_MS);
+  wifiLink.state = WIFI_LINK_WAITING;
+}
+
+// Time offline so far, the current outage included
+uint64_t wifiOfflineMs() {
+  uint64_t total = wifiLink.offlineMs;
+  if (wifiLink.state != WIFI_LINK_UP) total += millis() - wifiLink.downSince;
+  return total;
+}
+
+// Network task, every pass: advance the reconnect state machine
+void serviceWiFi() {
+  uint32_t now = millis();
+  bool dropped = wifiDropped.exchange(false, std::memory_order_acquire);
+  bool gotIP = wifiGotIP.exchange(false, std::memory_order_acquire);
+  bool connected = WiFi.status() == WL_CONNECTED;
+
+  if (wifiLink.state == WIFI_LINK_UP) {
+    if (!dropped && connected) return;
+
+    // Event, or a drop the event was missed for
+    wifiLink.disconnects++;
+    wifiLink.lastReason = wifiDropReason.load(std::memory_order_relaxed);
+    wifiLink.downSince = now;
+    wifiLink.backoffMs = WIFI_BACKOFF_MIN_MS;
+    scheduleReconnect(now);
+    DEBUG(Serial.printf("WiFi lost (reason %u), retrying in %lu ms\n",
+                        wifiLink.lastReason, (unsigned long)(wifiLink.nextAttemptAt - now)));
+    return;
+  }
+
+  if (gotIP || connected) {
+    wifiLink.lastOutageMs = now - wifiLink.downSince;
+    wifiLink.offlineMs += wifiLink.lastOutageMs;
+    wifiLink.state = WIFI_LINK_UP;
+    DEBUG(Serial.printf("WiFi back after %lu ms, %lu attempts so far\n",
+                        (unsigned long)wifiLink.lastOutageMs, (unsigned long)wifiLink.attempts));
+    startNTPSync();  // The clock may have drifted while offline
+    return;
+  }
+
+  if (wifiLink.state == WIFI_LINK_CONNECTING) {
+    if (dropped) {
+      wifiLink.lastReason = wifiDropReason.load(std::memory_order_relaxed);
+    }
+    if (dropped || now - wifiLink.attemptStartedAt >= WIFI_ATTEMPT_TIMEOUT_MS) {
+      scheduleReconnect(now);
+      DEBUG(Serial.printf("WiFi attempt failed (reason %u), next in %lu ms\n",
+                          wifiLink.lastReason, (unsigned long)(wifiLink.nextAttemptAt - now)));
+    }
+    return;
+  }
+
+  if ((int32_t)(now - wifiLink.nextAttemptAt) >= 0) {
+    wifiLink.attempts++;
+    wifiLink.attemptStartedAt = now;
+    wifiLink.state = WIFI_LINK_CONNECTING;
+    WiFi.reconnect();
+  }
+}
+
+// ======================== FIRMWARE UPDATE ========================
+// Firmware comes in through ArduinoOTA (espota, port 3232) or as a POST to
+// /update (multipart form, HTTP Basic auth with the OTA password):
+//   curl -u admin:CYD_OTA_2024 -F firmware=@.pio/build/esp32-cyd/firmware.bin http://<ip>/update
+// Uploads go into Update one network chunk at a time as they arrive, so no
+// more than a chunk is ever held in RAM. Progress reaches the matrix only when
+// the whole percentage changes, and the render task draws just the LEDs that
+// differ, so the display never holds up the flash writes.
+#define OTA_HOSTNAME             "CYD-Clock"
+#define OTA_USERNAME             "admin"          // /update only; espota has no user
+#define OTA_PASSWORD             "CYD_OTA_2024"   // Change this here and in platformio.ini (--auth)
+#define UPDATE_RESTART_DELAY_MS  1000             // Let the reply reach the client before rebooting
+
+struct FirmwareUpload {
+  const void* owner;         // HttpRequest::id() of the upload being written
+  bool taken;                // owner's upload has been started (and maybe finished)
+  bool active;               // Update is open for owner
+  bool ok;                   // Written and verified
+  size_t expected;           // Request body length (image plus form framing), 0 if unknown
+  size_t written;
+  unsigned long startedAt;
+  const char* error;         // Why it failed (static string)
+  uint32_t count;            // Uploads completed
+  uint32_t failures;         // Uploads rejected or failed
+  uint32_t lastBytesPerSec;  // Throughput of the last completed upload
+};
+
+FirmwareUpload firmwareUpload = {};
+int updateShownPercent = -1;   // Last progress put on the matrix
+unsigned long restartAt = 0;   // millis() a restart was asked for, 0 if none
+
+// Network side: both update paths report progress through here
+void showUpdateProgress(int percent) {
+  if (percent == updateShownPercent) return;
+  updateShownPercent = percent;
+  char msg[16];
+  snprintf(msg, sizeof(msg), "OTA %d%%", percent);
+  postMessage(msg, 0);
+}
+
+void beginUpdateDisplay() {
+  if (settingsDirty) commitSettings();  // Don't lose a pending change to the reboot
+  updateShownPercent = -1;
+  postMessage("OTA", 0);
+}
+
+void failFirmwareUpload(const char* error) {
+  firmwareUpload.active = false;
+  firmwareUpload.error = error;
+  firmwareUpload.failures++;
+  DEBUG(Serial.printf("Firmware upload failed: %s\n", error));
+  postMessage("OTA ERR", 2000);
+  pulseRGBLed(1, 0, 0);
+}
+
+// /update body, chunk by chunk
+void handleFirmwareUpload(HttpRequest& req, UploadStage stage, const uint8_t* data, size_t len) {
+  FirmwareUpload& u = firmwareUpload;
+
+  if (stage == UPLOAD_BEGIN) {
+    if (!req.authenticate(OTA_USERNAME, OTA_PASSWORD)) return;  // done() asks for credentials
+    if (u.active || Update.isRunning()) return;                 // Someone else's; done() says busy
+
+    u.owner = req.id();
+    u.taken = true;
+    u.ok = false;
+    u.error = nullptr;
+    u.written = 0;
+    u.expected = req.contentLength();
+    u.startedAt = millis();
+    if (!Update.begin(UPDATE_SIZE_UNKNOWN, U_FLASH)) {
+      failFirmwareUpload(Update.errorString());
+      return;
+    }
+    u.active = true;
+    DEBUG(Serial.printf("Firmware upload started (%u bytes)\n", (unsigned)u.expected));
+    beginUpdateDisplay();
+    return;
+  }
+
+  if (!u.active || u.owner != req.id()) return;
+
+  if (stage == UPLOAD_DATA) {
+    if (Update.write((uint8_t*)data, len) != len) {
+      Update.abort();
+      failFirmwareUpload(Update.errorString());
+      return;
+    }
+    u.written += len;
+    // The framing makes expected a little larger, so this tops out just short of 100
+    if (u.expected) showUpdateProgress(min(u.written * 100 / u.expected, (size_t)99));
+  } else if (stage == UPLOAD_END) {
+    if (!Update.end(true)) {  // true: size comes from what was written
+      failFirmwareUpload(Update.errorString());
+      return;
+    }
+    unsigned long ms = millis() - u.startedAt;
+    u.active = false;
+    u.ok = true;
+    u.count++;
+    u.lastBytesPerSec = ms ? (uint32_t)((uint64_t)u.written * 1000 / ms) : 0;
+    DEBUG(Serial.printf("Firmware upload complete: %u bytes in %lu ms\n", (unsigned)u.written, ms));
+    postMessage("OTA OK", 0);
+  } else {
+    Update.abort();
+    failFirmwareUpload("Upload aborted");
+  }
+}
+
+// /update reply, once the body is in
+void handleFirmwareDone(HttpRequest& req) {
+  FirmwareUpload& u = firmwareUpload;
+  if (!req.authenticate(OTA_USERNAME, OTA_PASSWORD)) {
+    req.requestAuthentication();
+    return;
+  }
+  if (!u.taken || u.owner != req.id()) {
+    bool busy = u.active;
+    req.send(busy ? 409 : 400, "text/plain", busy ? "Another update is in progress" : "No firmware in request");
+    return;
+  }
+
+  u.taken = false;
+  if (!u.ok) {
+    req.send(500, "text/plain", u.error ? u.error : "Update failed");
+    return;
+  }
+  req.sendHeader("Connection", "close");
+  req.send(200, "text/plain", "Update OK, restarting");
+  restartAt = millis() | 1;  // Network task restarts once the reply is out (0 = none)
+}
+
+// ======================== METRICS ========================
+// /metrics in Prometheus text format, pulled by the server a piece at a
+// time (see sendBody()). Every pass runs the whole list, skips the items
+// already sent and snprintfs the next ones straight into the server's buffer
+// until it is full, so a scrape never touches the heap on either server.
+// An item is never split; values in a later piece may be a moment newer.
+struct MetricsWriter {
+  char* buf;
+  size_t size;
+  size_t len;
+  uint32_t item;     // Items seen this pass
+  uint32_t skip;     // Items sent by earlier passes
+  uint32_t written;  // Items added this pass
+  bool full;
+};
+
+void metricsPrintf(MetricsWriter& w, const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+
+void metricsPrintf(MetricsWriter& w, const char* fmt, ...) {
+  if (w.item++ < w.skip || w.full) return;
+  va_list args;
+  va_start(args, fmt);
+  int n = vsnprintf(w.buf + w.len, w.size - w.len, fmt, args);
+  va_end(args);
+  if (n < 0 || (size_t)n >= w.size - w.len) {
+    w.full = true;  // Left for the next piece (vsnprintf's partial output is ignored)
+    return;
+  }
+  w.len += n;
+  w.written++;
+}
+
+void metric(MetricsWriter& w, const char* name, const char* type, const char* help, long long value) {
+  metricsPrintf(w, "# HELP %s %s\n# TYPE %s %s\n%s %lld\n", name, help, name, type, name, value);
+}
+
+void writeMetrics(MetricsWriter& w) {
+  metricsPrintf(w, "# HELP cyd_build_info Firmware build\n# TYPE cyd_build_info gauge\n"
+                   "cyd_build_info{web=\"%s\"} 1\n", WEB_INDEX_BUILD);
+  metric(w, "cyd_uptime_seconds", "gauge", "Time since boot", esp_timer_get_time() / 1000000LL);
+
+  metric(w, "cyd_heap_free_bytes", "gauge", "Free heap", ESP.getFreeHeap());
+  metric(w, "cyd_heap_min_free_bytes", "gauge", "Lowest free heap since boot", ESP.getMinFreeHeap());
+  metric(w, "cyd_heap_largest_free_block_bytes", "gauge", "Largest allocatable block",
+         heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
+
+  bool connected = WiFi.status() == WL_CONNECTED;
+  metric(w, "cyd_wifi_connected", "gauge", "1 if associated with the access point", connected);
+  metric(w, "cyd_wifi_rssi_dbm", "gauge", "Received signal strength", connected ? WiFi.RSSI() : 0);
+  metric(w, "cyd_wifi_reconnects_total", "counter", "Reconnect attempts", wifiLink.attempts);
+  metric(w, "cyd_wifi_disconnects_total", "counter", "Drops of an established connection", wifiLink.disconnects);
+  metric(w, "cyd_wifi_offline_ms_total", "counter", "Time spent disconnected", wifiOfflineMs());
+  metric(w, "cyd_wifi_last_outage_ms", "gauge", "Length of the last completed outage", wifiLink.lastOutageMs);
+  metric(w, "cyd_wifi_reconnect_backoff_ms", "gauge", "Wait before the next attempt after this one fails",
+         wifiLink.state == WIFI_LINK_UP ? 0 : wifiLink.backoffMs);
+  metric(w, "cyd_wifi_last_disconnect_reason", "gauge", "Driver reason code of the last disconnect",
+         wifiLink.lastReason);
+
+  metric(w, "cyd_ntp_syncs_total", "counter", "Completed NTP syncs", ntp.syncCount);
+  metric(w, "cyd_ntp_failures_total", "counter", "NTP requests that timed out", ntp.failCount);
+  metric(w, "cyd_ntp_offset_ms", "gauge", "Clock correction applied by the last sync", ntp.lastOffsetMs);
+  metric(w, "cyd_ntp_latency_ms", "gauge", "Request to response time of the last sync", ntp.lastLatencyMs);
+  metric(w, "cyd_ntp_last_sync_timestamp_seconds", "gauge", "Time of the last sync", ntp.lastSync);
+
+  metric(w, "cyd_fleet_role", "gauge", "0 standalone, 1 leader, 2 follower", fleetRole);
+  metric(w, "cyd_fleet_leader_present", "gauge", "1 if following a leader's beacons", fleet.leaderPresent);
+  metric(w, "cyd_fleet_beacons_sent_total", "counter", "Time beacons multicast", fleet.beaconsSent);
+  metric(w, "cyd_fleet_beacons_received_total", "counter", "Leader beacons received", fleet.beaconsReceived);
+  metric(w, "cyd_fleet_offset_us", "gauge", "Leader minus local clock, last beacon (transit included)",
+         fleet.lastOffsetUs);
+  metric(w, "cyd_fleet_corrections_total", "counter", "Clock steps onto the leader", fleet.corrections);
+  metric(w, "cyd_fleet_last_correction_us", "gauge", "Size of the last clock step", fleet.lastCorrectionUs);
+
+  metric(w, "cyd_night_mode", "gauge", "1 while the night face and power saving are on", power.night);
+  metric(w, "cyd_night_mode_entries_total", "counter", "Times night mode was entered", power.nightCount);
+  metric(w, "cyd_cpu_frequency_mhz", "gauge", "CPU clock", getCpuFrequencyMhz());
+  metric(w, "cyd_backlight_duty", "gauge", "Backlight PWM duty, 0-255", power.backlightDuty);
+  metric(w, "cyd_ambient_light_level", "gauge", "Smoothed LDR reading (higher is darker), -1 if unread",
+         power.ldrLevel);
+  metric(w, "cyd_estimated_current_ma", "gauge", "Modelled supply current, not measured",
+         estimatedCurrentMa());
+
+  metric(w, "cyd_sensor_available", "gauge", "1 if a sensor is producing readings", displayState.sensorAvailable);
+  metric(w, "cyd_sensor_reads_total", "counter", "Completed sensor readings", sensorPipeline.readCount);
+  metric(w, "cyd_sensor_errors_total", "counter", "Failed sensor conversions", sensorPipeline.failCount);
+
+  frameChannel.update();
+  metric(w, "cyd_frames_rendered_total", "counter", "Display refresh passes",
+         framesRendered.load(std::memory_order_relaxed));
+  metric(w, "cyd_frames_changed_total", "counter", "Refreshes that changed the display",
+         frameChannel.front().seq);
+  metric(w, "cyd_animation_frames_total", "counter", "Animation frames drawn",
+         animationFrames.load(std::memory_order_relaxed));
+  metric(w, "cyd_animation_frames_dropped_total", "counter", "Animation frame slots skipped to stay on time",
+         animationFramesDropped.load(std::memory_order_relaxed));
+
+  metric(w, "cyd_http_requests_total", "counter", "HTTP requests received",
+         httpRequests.load(std::memory_order_relaxed));
+  metric(w, "cyd_firmware_uploads_total", "counter", "Firmware uploads written via /update", firmwareUpload.count);
+  metric(w, "cyd_firmware_upload_failures_total", "counter", "Firmware uploads that failed",
+         firmwareUpload.failures);
+  metric(w, "cyd_firmware_upload_bytes_per_second", "gauge", "Throughput of the last upload",
+         firmwareUpload.lastBytesPerSec);
+  metric(w, "cyd_event_clients", "gauge", "Connected /api/events streams",
+         eventClients.load(std::memory_order_relaxed));
+
+#if PERF_ENABLED
+  // Timing probes as summaries, in microseconds
+  uint32_t mhz = getCpuFrequencyMhz();
+  metricsPrintf(w, "# HELP cyd_probe_microseconds Time spent in instrumented code\n"
+                   "# TYPE cyd_probe_microseconds summary\n");
+  for (int i = 0; i < PERF_PROBE_COUNT; i++) {
+    if (perfProbeIsCount(i)) continue;  // A count, not a time
+    const PerfStat& stat = perfStats[i];
+    const char* name = perfProbeNames[i];
+    uint32_t div = perfProbeIsMicros(i) ? 1 : mhz;
+    metricsPrintf(w, "cyd_probe_microseconds{probe=\"%s\",quantile=\"0.5\"} %lu\n"
+                     "cyd_probe_microseconds{probe=\"%s\",quantile=\"0.99\"} %lu\n"
+                     "cyd_probe_microseconds_sum{probe=\"%s\"} %llu\n"
+                     "cyd_probe_microseconds_count{probe=\"%s\"} %lu\n",
+                  name, (unsigned long)(stat.percentile(50) / div),
+                  name, (unsigned long)(stat.percentile(99) / div),
+                  name, (unsigned long long)stat.average() * stat.samples() / div,
+                  name, (unsigned long)stat.samples());
+  }
+#endif
+}
+
+size_t fillMetrics(uint8_t* buf, size_t maxLen, size_t, HttpCursor& cursor) {
+  MetricsWriter w = {(char*)buf, maxLen, 0, 0, cursor.pos, 0, false};
+  {
+    NetworkLock lock;
+    writeMetrics(w);
+  }
+  cursor.pos += w.written;
+  if (w.len == 0) return w.full ? HTTP_FILL_AGAIN : 0;
+  return w.len;
+}
+
+void handleMetrics(HttpRequest& req) {
+  req.sendBody<fillMetrics>(200, "text/plain; version=0.0.4", HTTP_LENGTH_UNKNOWN, HttpCursor());
+}
+
+// ======================== WEB SERVER FUNCTIONS ========================
+
+typedef void (*HttpHandler)(HttpRequest& req);
+typedef void (*UploadHandler)(HttpRequest& req, UploadStage stage, const uint8_t* data, size_t len);
+
+unsigned long wifiResetAt = 0;  // millis() of a /reset request, 0 if none
+
+// Common entry for every route: counted and run under the network lock.
+// The async server also times each handler (the blocking one times handleClient()).
+void runHandler(HttpHandler handler, HttpRequest& req) {
+  NetworkLock lock;
+  httpRequests++;
+#if ASYNC_WEB_SERVER
+  PERF_SCOPE(PERF_HANDLE_CLIENT);
+#endif
+  handler(req);
+}
+
+// Register a handler for uri (any method); nullptr = requests no route takes
+void route(const char* uri, HttpHandler handler) {
+#if ASYNC_WEB_SERVER
+  ArRequestHandlerFunction fn = [handler](AsyncWebServerRequest* request) {
+    HttpRequest req(request);
+    runHandler(handler, req);
+  };
+#else
+  WebServer::THandlerFunction fn = [handler]() {
+    HttpRequest req;
+    runHandler(handler, req);
+  };
+#endif
+  if (uri) {
+    server.on(uri, fn);
+  } else {
+    server.onNotFound(fn);
+  }
+}
+
+// Register a POST endpoint whose body is handed to onUpload chunk by chunk as it
+// arrives; done answers once the body is in. Chunks run under the network lock.
+void routeUpload(const char* uri, HttpHandler done, UploadHandler onUpload) {
+#if ASYNC_WEB_SERVER
+  ArRequestHandlerFunction fn = [done](AsyncWebServerRequest* request) {
+    HttpRequest req(request);
+    runHandler(done, req);
+  };
+  ArUploadHandlerFunction chunk = [onUpload](AsyncWebServerRequest* request, const String& filename,
+                                             size_t index, uint8_t* data, size_t len, bool final) {
+    HttpRequest req(request);
+    NetworkLock lock;
+    if (index == 0) {
+      // Also fires after a normal finish, by when the upload is no longer open
+      request->onDisconnect([onUpload, request]() {
+        HttpRequest gone(request);
+        NetworkLock lock;
+        onUpload(gone, UPLOAD_ABORT, nullptr, 0);
+      });
+      onUpload(req, UPLOAD_BEGIN, nullptr, 0);
     }
-    refreshAll();
-  }
+    if (len) onUpload(req, UPLOAD_DATA, data, len);
+    if (final) onUpload(req, UPLOAD_END, nullptr, 0);
+  };
+  server.on(uri, HTTP_POST, fn, chunk);
+#else
+  WebServer::THandlerFunction fn = [done]() {
+    HttpRequest req;
+    runHandler(done, req);
+  };
+  WebServer::THandlerFunction chunk = [onUpload]() {
+    HTTPUpload& upload = server.upload();
+    HttpRequest req;
+    switch (upload.status) {
+      case UPLOAD_FILE_START:   onUpload(req, UPLOAD_BEGIN, nullptr, 0); break;
+      case UPLOAD_FILE_WRITE:   onUpload(req, UPLOAD_DATA, upload.buf, upload.currentSize); break;
+      case UPLOAD_FILE_END:     onUpload(req, UPLOAD_END, nullptr, 0); break;
+      case UPLOAD_FILE_ABORTED: onUpload(req, UPLOAD_ABORT, nullptr, 0); break;
+    }
+  };
+  server.on(uri, HTTP_POST, fn, chunk);
+#endif
+}
 
-  // Auto-switch modes (using user-configurable interval)
-  if (millis() - lastModeSwitch > (modeSwitchInterval * 1000)) {
-    currentMode = (currentMode + 1) % 3;
-    lastModeSwitch = millis();
+// Settings endpoints: the dashboard calls them with fetch() and only needs
+// to know they were applied; a bookmark or plain link is sent back to /
+void sendSettingsDone(HttpRequest& req) {
+  if (req.header("X-Requested-With").length() > 0) {
+    req.send(204);
+    return;
   }
+  req.sendHeader("Location", "/");
+  req.send(302, "text/plain", "");
 }
 
-// ======================== WEB SERVER FUNCTIONS ========================
+// Bodies of the JSON and binary status routes, formatted whole when sent
+// (see sendFormatted()). formatTimeJson() is shared with DISPLAY EVENTS.
+
+// Settings and status the dashboard fills in after loading
+int formatConfigJson(char* out, size_t size) {
+  const char* sensorDetail = activeSensor ? activeSensor->detail : "";
+  const bool hasPressure = activeSensor && activeSensor->hasPressure;
+
+  return snprintf(out, size,
+                  "{\"build\":\"%s\",\"matrixWidth\":%d,\"matrixHeight\":%d,"
+                  "\"sensorAvailable\":%s,\"sensorType\":\"%s\",\"sensorDetail\":\"%s\",\"hasPressure\":%s,"
+                  "\"temperature\":%d,\"humidity\":%d,\"pressure\":%d,\"useFahrenheit\":%s,"
+                  "\"displayStyle\":%d,\"displayRotation\":%u,\"ledColor\":%u,\"surroundColor\":%u,"
+                  "\"ledSize\":%d,\"ledSpacing\":%d,\"modeSwitchInterval\":%d,"
+                  "\"timezone\":%d,\"timezoneName\":\"%s\","
+                  "\"use24hour\":%s,\"leadingZero\":%s,\"dateFormat\":%d,"
+                  "\"fleetRole\":%d,\"fleetMirror\":%s,\"fleetLeader\":%s,"
+                  "\"nightTrigger\":%d,\"nightStart\":%d,\"nightEnd\":%d,\"nightBrightness\":%d,"
+                  "\"nightActive\":%s,"
+                  "\"ip\":\"%s\",\"uptime\":%lu,\"freeHeap\":%lu}",
+                  WEB_INDEX_BUILD, TOTAL_WIDTH, TOTAL_HEIGHT,
+                  displayState.sensorAvailable ? "true" : "false", sensorType, sensorDetail,
+                  hasPressure ? "true" : "false",
+                  displayState.temperature, displayState.humidity, displayState.pressure,
+                  displayState.useFahrenheit ? "true" : "false",
+                  displayState.displayStyle, displayState.displayRotation,
+                  displayState.ledOnColor, displayState.ledSurroundColor,
+                  displayState.ledSize, displayState.ledSpacing, displayState.modeSwitchInterval,
+                  currentTimezone, timezones[currentTimezone].name,
+                  displayState.use24HourFormat ? "true" : "false",
+                  displayState.showLeadingZero ? "true" : "false", displayState.dateFormat,
+                  fleetRole, fleetMirror ? "true" : "false", fleet.leaderPresent ? "true" : "false",
+                  nightTrigger, nightStart, nightEnd, nightBrightness, power.night ? "true" : "false",
+                  WiFi.localIP().toString().c_str(), millis() / 1000,
+                  (unsigned long)ESP.getFreeHeap());
+}
 
-void setupWebServer() {
-  // Root page handler
-  server.on("/", []() {
-    String html = "<!DOCTYPE html><html><head>";
-    html += "<meta charset='UTF-8'>";
-    html += "<meta name='viewport' content='width=device-width, initial-scale=1.0'>";
-    html += "<title>CYD LED Clock</title>";
-    html += "<style>";
-    html += "*{box-sizing:border-box;}";
-    html += "body{font-family:'Segoe UI',Arial,sans-serif;margin:0;padding:10px;background:#1a1a1a;color:#fff;max-width:1200px;margin:0 auto;}";
-    html += ".header{text-align:center;margin-bottom:12px;}";
-    html += "h1{color:#fff;font-size:clamp(20px,5vw,26px);font-weight:600;margin:0 0 15px 0;}";
-    html += ".time-display{background:linear-gradient(135deg,#2a2a2a,#1e1e1e);padding:clamp(15px,4vw,25px);border-radius:12px;box-shadow:0 4px 16px rgba(0,0,0,0.3);margin-bottom:12px;}";
-    html += ".time-display h2{color:#aaa;font-size:clamp(14px,4vw,18px);font-weight:400;margin:0 0 10px 0;text-align:left;}";
-    html += ".clock{font-size:clamp(40px,12vw,90px);font-weight:700;text-align:center;margin:10px 0;font-family:'Courier New',monospace;color:#7CFC00;text-shadow:0 0 20px rgba(124,252,0,0.5);line-height:1.1;}";
-    html += ".date{font-size:clamp(20px,6vw,38px);font-weight:600;text-align:center;margin:10px 0;font-family:'Courier New',monospace;color:#4A90E2;text-shadow:0 0 15px rgba(74,144,226,0.5);line-height:1.2;}";
-    html += ".environment{background:linear-gradient(135deg,#2a2a2a,#1e1e1e);padding:clamp(15px,3vw,25px);border-radius:12px;box-shadow:0 4px 16px rgba(0,0,0,0.3);margin-bottom:12px;}";
-    html += ".environment p{margin:6px 0;}";
-    html += ".env-grid{display:grid;grid-template-columns:repeat(auto-fit,minmax(140px,1fr));gap:clamp(12px,3vw,20px);text-align:center;}";
-    html += ".env-item{padding:clamp(12px,3vw,16px);background:rgba(255,255,255,0.05);border-radius:8px;transition:transform 0.2s;}";
-    html += ".env-item:hover{transform:translateY(-3px);background:rgba(255,255,255,0.08);}";
-    html += ".env-icon{font-size:clamp(32px,8vw,48px);margin-bottom:6px;display:block;}";
-    html += ".env-value{font-size:clamp(20px,5vw,30px);font-weight:700;margin:6px 0;font-family:'Courier New',monospace;line-height:1.2;}";
-    html += ".env-label{font-size:clamp(11px,3vw,14px);color:#aaa;text-transform:uppercase;letter-spacing:0.5px;}";
-    html += ".card{background:linear-gradient(135deg,#2a2a2a,#1e1e1e);padding:clamp(12px,3vw,16px);margin:8px 0;border-radius:8px;box-shadow:0 3px 12px rgba(0,0,0,0.3);}";
-    html += "h2{color:#aaa;border-bottom:2px solid #4CAF50;padding-bottom:4px;font-size:clamp(15px,4vw,17px);font-weight:500;margin:0 0 10px 0;}";
-    html += "button{background:#4CAF50;color:white;border:none;padding:8px 12px;cursor:pointer;border-radius:5px;margin:4px 4px 4px 0;font-size:clamp(12px,3vw,13px);white-space:nowrap;}";
-    html += "button:hover{background:#45a049;}";
-    html += "select{padding:6px;font-size:clamp(12px,3vw,13px);background:#1e1e1e;color:#fff;border:1px solid #444;border-radius:5px;width:100%;max-width:280px;}";
-    html += "p{color:#ccc;font-size:clamp(12px,3vw,14px);line-height:1.5;margin:6px 0;}";
-    html += ".status-pill{display:inline-block;padding:4px 10px;border-radius:999px;font-size:12px;font-weight:700;letter-spacing:0.3px;border:1px solid #2e7d32;background:#1f3b23;color:#9CFF9C;}";
-    html += ".status-subtext{display:block;color:#aaa;font-size:12px;margin-top:4px;}";
-    html += ".note{background:rgba(255,255,255,0.04);border:1px dashed #555;padding:8px;border-radius:6px;color:#ccc;font-size:12px;margin-top:8px;line-height:1.5;}";
-    html += "@media(max-width:768px){";
-    html += ".env-grid{grid-template-columns:1fr;}";
-    html += ".clock{font-size:clamp(40px,12vw,80px);}";
-    html += ".date{font-size:clamp(20px,6vw,36px);}";
-    html += "body{padding:8px;}";
-    html += ".time-display,.environment,.card{padding:12px;}";
-    html += "}";
-    // TFT Display Mirror styles
-    html += ".tft-mirror{background:linear-gradient(135deg,#2a2a2a,#1e1e1e);padding:clamp(12px,3vw,20px);border-radius:12px;box-shadow:0 4px 16px rgba(0,0,0,0.3);margin-bottom:12px;text-align:center;}";
-    html += ".tft-mirror h2{color:#aaa;border-bottom:2px solid #E91E63;padding-bottom:4px;font-size:clamp(15px,4vw,17px);font-weight:500;margin:0 0 10px 0;text-align:left;}";
-    html += ".canvas-container{display:flex;justify-content:center;align-items:center;padding:12px;background:#000;border-radius:8px;margin-top:10px;}";
-    html += "#tftCanvas{image-rendering:pixelated;image-rendering:crisp-edges;border:2px solid #444;border-radius:4px;box-shadow:0 0 8px rgba(68,68,68,0.5);}";
-    html += ".tft-label{color:#888;font-size:11px;margin-top:8px;}";
-    html += ".footer{background:linear-gradient(135deg,#2a2a2a,#1e1e1e);padding:16px;margin:12px 0 0 0;border-radius:8px;box-shadow:0 3px 12px rgba(0,0,0,0.3);text-align:center;}";
-    html += ".footer-content{display:flex;align-items:center;justify-content:center;gap:8px;flex-wrap:wrap;margin-bottom:12px;}";
-    html += ".footer-link{color:#4CAF50;text-decoration:none;font-size:clamp(14px,3.5vw,16px);font-weight:500;transition:color 0.3s;}";
-    html += ".footer-link:hover{color:#66BB6A;}";
-    html += ".footer-separator{color:#666;font-size:clamp(14px,3.5vw,16px);}";
-    html += ".footer-heart{color:#E91E63;font-size:clamp(14px,3.5vw,16px);}";
-    html += ".footer-credit{color:#888;font-size:clamp(11px,3vw,13px);margin-top:8px;line-height:1.6;}";
-    html += ".footer-credit a{color:#4A90E2;text-decoration:none;}";
-    html += ".footer-credit a:hover{color:#6BA9E8;text-decoration:underline;}";
-    html += "</style>";
-    html += "<script>";
-    html += "function formatDate(day,month,year,fmt){";
-    html += "var d=(day<10?'0':'')+day,m=(month<10?'0':'')+month,y2=(''+year).slice(-2),y4=year;";
-    html += "if(fmt===0)return d+'/'+m+'/'+y2;";
-    html += "if(fmt===1)return m+'/'+d+'/'+y2;";
-    html += "if(fmt===2)return y4+'-'+m+'-'+d;";
-    html += "if(fmt===3)return d+'.'+m+'.'+y4;";
-    html += "if(fmt===4)return m+'.'+d+'.'+y4;";
-    html += "return d+'/'+m+'/'+y2;";
-    html += "}";
-    html += "function updateTime(){";
-    html += "fetch('/api/time')";
-    html += ".then(function(r){return r.json();})";
-    html += ".then(function(d){";
-    html += "var clock=document.getElementById('clock');";
-    html += "var date=document.getElementById('date');";
-    html += "var h=d.hours;";
-    html += "var ampm='';";
-    html += "if(!d.use24hour){";
-    html += "ampm=(h>=12)?' PM':' AM';";
-    html += "h=(h%12)||12;";
-    html += "}";
-    html += "if(clock){clock.textContent=(d.use24hour&&h<10?'0':'')+h+':'+(d.minutes<10?'0':'')+d.minutes+':'+(d.seconds<10?'0':'')+d.seconds+ampm;}";
-    html += "if(date){date.textContent=formatDate(d.day,d.month,d.year,d.dateFormat);}";
-    html += "})";
-    html += ".catch(function(e){console.log('Update failed:',e);});";
-    html += "}";
-    html += "setInterval(updateTime,1000);";
-    html += "setTimeout(updateTime,100);";
-    // TFT Display Mirror - Canvas rendering functions
-    html += "var tftCanvas,tftCtx,ledSize=9,gapSize=4;";
-    html += "function rgb565ToHex(c){var r=((c>>11)&0x1F)*8,g=((c>>5)&0x3F)*4,b=(c&0x1F)*8;return'rgb('+r+','+g+','+b+')';}";
-    html += "function dimColor(r,g,b,f){return'rgb('+Math.floor(r/f)+','+Math.floor(g/f)+','+Math.floor(b/f)+')';}";
-    html += "function initCanvas(){";
-    html += "tftCanvas=document.getElementById('tftCanvas');";
-    html += "if(!tftCanvas)return;";
-    html += "tftCtx=tftCanvas.getContext('2d');";
-    html += "tftCanvas.width=32*ledSize;";
-    html += "tftCanvas.height=16*ledSize+gapSize;";
-    html += "tftCtx.fillStyle='#000';tftCtx.fillRect(0,0,tftCanvas.width,tftCanvas.height);";
-    html += "}";
-    html += "function drawLED(x,y,lit,style,ledColor,surroundColor){";
-    html += "var gap=(y>=8)?gapSize:0;";
-    html += "var sx=x*ledSize,sy=y*ledSize+gap;";
-    html += "var onCol=rgb565ToHex(ledColor);";
-    html += "var surCol=rgb565ToHex(surroundColor);";
-    html += "if(style===0){";
-    html += "tftCtx.fillStyle=lit?onCol:'#000';";
-    html += "tftCtx.fillRect(sx,sy,ledSize,ledSize);";
-    html += "}else{";
-    html += "tftCtx.fillStyle='#000';tftCtx.fillRect(sx,sy,ledSize,ledSize);";
-    html += "if(lit){";
-    html += "tftCtx.fillStyle=surCol;";
-    html += "tftCtx.beginPath();tftCtx.arc(sx+ledSize/2,sy+ledSize/2,ledSize/2-1,0,Math.PI*2);tftCtx.fill();";
-    html += "tftCtx.fillStyle=onCol;";
-    html += "tftCtx.beginPath();tftCtx.arc(sx+ledSize/2,sy+ledSize/2,ledSize/2-2,0,Math.PI*2);tftCtx.fill();";
-    html += "}else{";
-    html += "tftCtx.fillStyle='#180000';";
-    html += "tftCtx.beginPath();tftCtx.arc(sx+ledSize/2,sy+ledSize/2,ledSize/2-2,0,Math.PI*2);tftCtx.fill();";
-    html += "}}}";
-    html += "function updateDisplay(){";
-    html += "fetch('/api/display')";
-    html += ".then(function(r){return r.json();})";
-    html += ".then(function(d){";
-    html += "if(!tftCtx)initCanvas();";
-    html += "if(!tftCtx)return;";
-    html += "var buf=d.buffer,w=d.width,style=d.style,ledCol=d.ledColor,surCol=d.surroundColor;";
-    html += "for(var row=0;row<2;row++){";
-    html += "for(var x=0;x<32;x++){";
-    html += "var byteVal=buf[x+row*32];";
-    html += "for(var bit=0;bit<8;bit++){";
-    html += "var y=row*8+bit;";
-    html += "var lit=(byteVal&(1<<bit))!==0;";
-    html += "drawLED(x,y,lit,style,ledCol,surCol);";
-    html += "}}}})";
-    html += ".catch(function(e){console.log('Display update failed:',e);});";
-    html += "}";
-    html += "setInterval(updateDisplay,500);";
-    html += "setTimeout(function(){initCanvas();updateDisplay();},200);";
-    html += "</script>";
-    html += "</head><body>";
-    html += "<div class='header'><h1>ESP32 CYD LED Matrix Clock</h1></div>";
-
-    html += "<div class='time-display'>";
-    html += "<h2>Current Time & Environment</h2>";
-    html += "<div class='clock' id='clock'>--:--:--</div>";
-    html += "<div class='date' id='date'>--/--/----</div>";
-    html += "</div>";
-
-    html += "<div class='tft-mirror'>";
-    html += "<h2>TFT Display Mirror</h2>";
-    html += "<div class='canvas-container'><canvas id='tftCanvas'></canvas></div>";
-    html += "<p class='tft-label'>Live display - Updates every 500ms | 32×16 LED Matrix</p>";
-    html += "<p style='color:#888;font-size:12px;margin:4px 0 0 0;'>💡 Tip: If seconds are truncated, adjust LED Size or Spacing below</p>";
-    html += "</div>";
-
-    if (sensorAvailable) {
-      int tempDisplay = useFahrenheit ? (temperature * 9 / 5 + 32) : temperature;
-
-      String tempIcon = "🌡️";
-      String tempColor = "#FFA500";
-      if (temperature >= 30) {
-        tempIcon = "🔥";
-        tempColor = "#FF4444";
-      } else if (temperature >= 25) {
-        tempIcon = "☀️";
-        tempColor = "#FFB347";
-      } else if (temperature >= 20) {
-        tempIcon = "🌤️";
-        tempColor = "#FFD700";
-      } else if (temperature >= 15) {
-        tempIcon = "⛅";
-        tempColor = "#87CEEB";
-      } else if (temperature >= 10) {
-        tempIcon = "☁️";
-        tempColor = "#B0C4DE";
-      } else if (temperature >= 5) {
-        tempIcon = "🌧️";
-        tempColor = "#4682B4";
-      } else {
-        tempIcon = "❄️";
-        tempColor = "#00CED1";
-      }
+int formatDisplayJson(char* out, size_t size) {
+  frameChannel.update();
+  const FrameSnapshot& frame = frameChannel.front();
 
-      String humidityIcon = "💧";
-      String humidityColor = "#4A90E2";
-      if (humidity >= 70) {
-        humidityIcon = "💦";
-        humidityColor = "#1E90FF";
-      } else if (humidity <= 30) {
-        humidityIcon = "🏜️";
-        humidityColor = "#DEB887";
-      }
+  int len = snprintf(out, size, "{\"buffer\":[");
+  for (int i = 0; i < Matrix::SIZE; i++) {
+    len += snprintf(out + len, size - len, i ? ",%u" : "%u", frame.scr.columnByte(i));
+  }
+  len += snprintf(out + len, size - len,
+                  "],\"width\":%d,\"height\":%d,\"style\":%d,\"ledColor\":%u,\"surroundColor\":%u,\"seq\":%lu}",
+                  LINE_WIDTH, TOTAL_HEIGHT, frame.displayStyle, frame.ledOnColor,
+                  frame.ledSurroundColor, (unsigned long)frame.seq);
+  return len;
+}
 
-      html += "<div class='environment'>";
-      html += "<div class='env-grid'>";
-
-      html += "<div class='env-item'>";
-      html += "<span class='env-icon'>" + tempIcon + "</span>";
-      html += "<div class='env-value' style='color:" + tempColor + ";text-shadow:0 0 20px " + tempColor + "44;'>" + String(tempDisplay) + (useFahrenheit ? "°F" : "°C") + "</div>";
-      html += "<div class='env-label'>Temperature</div>";
-      html += "</div>";
-
-      html += "<div class='env-item'>";
-      html += "<span class='env-icon'>" + humidityIcon + "</span>";
-      html += "<div class='env-value' style='color:" + humidityColor + ";text-shadow:0 0 20px " + humidityColor + "44;'>" + String(humidity) + "%</div>";
-      html += "<div class='env-label'>Humidity</div>";
-      html += "</div>";
-
-#ifdef USE_BME280
-      // Only show pressure for BME280 sensor
-      html += "<div class='env-item'>";
-      html += "<span class='env-icon'>🌍</span>";
-      html += "<div class='env-value' style='color:#9370DB;text-shadow:0 0 20px #9370DB44;'>" + String(pressure) + "</div>";
-      html += "<div class='env-label'>Pressure (hPa)</div>";
-      html += "</div>";
+// Binary display frame, see /api/display.bin
+int formatDisplayFrame(char* out, size_t size) {
+  if (size < DISPLAY_FRAME_HEADER + Matrix::SIZE) return 0;
+  frameChannel.update();
+  const FrameSnapshot& frame = frameChannel.front();
+  uint8_t* buf = (uint8_t*)out;
+  buf[0] = DISPLAY_FRAME_VERSION;
+  buf[1] = LINE_WIDTH;
+  buf[2] = TOTAL_HEIGHT;
+  buf[3] = (uint8_t)frame.displayStyle;
+  buf[4] = frame.ledOnColor & 0xFF;
+  buf[5] = frame.ledOnColor >> 8;
+  buf[6] = frame.ledSurroundColor & 0xFF;
+  buf[7] = frame.ledSurroundColor >> 8;
+  buf[8] = frame.seq & 0xFF;
+  buf[9] = (frame.seq >> 8) & 0xFF;
+  buf[10] = (frame.seq >> 16) & 0xFF;
+  buf[11] = frame.seq >> 24;
+  frame.scr.toColumns(buf + DISPLAY_FRAME_HEADER);
+  return DISPLAY_FRAME_HEADER + Matrix::SIZE;
+}
+
+#if PERF_ENABLED
+int formatPerfJson(char* out, size_t size) {
+  uint32_t mhz = getCpuFrequencyMhz();
+  int len = snprintf(out, size, "{\"cpuMHz\":%lu,\"freeHeap\":%lu,\"probes\":{",
+                     (unsigned long)mhz, (unsigned long)ESP.getFreeHeap());
+  for (int i = 0; i < PERF_PROBE_COUNT; i++) {
+    const PerfStat& stat = perfStats[i];
+    bool isCount = perfProbeIsCount(i);
+    uint32_t div = (isCount || perfProbeIsMicros(i)) ? 1 : mhz;
+    len += snprintf(out + len, size - len,
+                    "%s\"%s\":{\"unit\":\"%s\",\"samples\":%lu,\"min\":%lu,\"avg\":%lu,\"max\":%lu,\"p99\":%lu}",
+                    i ? "," : "", perfProbeNames[i], isCount ? "count" : "us",
+                    (unsigned long)stat.samples(), (unsigned long)(stat.min() / div),
+                    (unsigned long)(stat.average() / div), (unsigned long)(stat.max() / div),
+                    (unsigned long)(stat.percentile(99) / div));
+  }
+  len += snprintf(out + len, size - len,
+                  "},\"power\":{\"night\":%s,\"cpuMHz\":%d,\"pm\":%s,\"lightSleep\":%s,"
+                  "\"backlight\":%d,\"wifiPs\":%d,\"ldr\":%d,\"estCurrentMa\":%lu}}",
+                  power.night ? "true" : "false", power.cpuMhz, power.pmActive ? "true" : "false",
+                  (power.pmActive && POWER_LIGHT_SLEEP) ? "true" : "false", power.backlightDuty,
+                  power.wifiPs, power.ldrLevel, (unsigned long)estimatedCurrentMa());
+  return len;
+}
+
+int formatPerfJsonAndReset(char* out, size_t size) {
+  int len = formatPerfJson(out, size);
+  for (int i = 0; i < PERF_PROBE_COUNT; i++) perfStats[i].reset();
+  return len;
+}
 #endif
 
-      html += "</div></div>";
+// /api/timezones body, ["name",...]; cursor.pos is the next entry (numTimezones = the ']')
+size_t fillTimezones(uint8_t* buf, size_t maxLen, size_t, HttpCursor& cursor) {
+  char* out = (char*)buf;
+  size_t len = 0;
+  for (; cursor.pos <= (uint32_t)numTimezones; cursor.pos++) {
+    int i = cursor.pos;
+    int n = (i < numTimezones) ? snprintf(out + len, maxLen - len, "%c\"%s\"", i ? ',' : '[', timezones[i].name)
+                               : snprintf(out + len, maxLen - len, "]");
+    if (n < 0 || (size_t)n >= maxLen - len) break;  // Next piece
+    len += n;
+  }
+  if (len == 0) return cursor.pos <= (uint32_t)numTimezones ? HTTP_FILL_AGAIN : 0;
+  return len;
+}
+
+void setupWebServer() {
+  // Root page: static gzipped asset streamed from flash (see web/index.html)
+  route("/", [](HttpRequest& req) {
+    req.sendHeader("ETag", "\"" WEB_INDEX_BUILD "\"");
+    req.sendHeader("Cache-Control", "max-age=86400");
+    if (req.header("If-None-Match") == "\"" WEB_INDEX_BUILD "\"") {
+      req.send(304);
+      return;
     }
+    req.sendHeader("Content-Encoding", "gzip");
+    req.sendStatic(200, "text/html", WEB_INDEX_GZ, WEB_INDEX_GZ_LEN);
+  });
 
-    html += "<div class='card'><h2>Settings</h2>";
-    html += "<button onclick=\"location.href='/temperature?mode=toggle'\" style='margin:0;'>Toggle °C/°F</button>";
-    html += "</div>";
-    
-    html += "<div class='card'><h2>Display Style</h2>";
-    html += "<p style='margin:4px 0;'>Current Style: " + String(displayStyle == 0 ? "Default (Blocks)" : "Realistic (LEDs)") + "</p>";
-    html += "<button onclick=\"location.href='/style?mode=toggle'\">Toggle Style</button><br>";
-
-    html += "<p style='margin:8px 0 4px 0;'>Display Rotation: " + String(displayRotation == 1 ? "Normal" : "Flipped 180°") + "</p>";
-    html += "<button onclick=\"location.href='/rotation?mode=toggle'\">Flip Display</button><br>";
-
-    html += "<p style='margin:8px 0 4px 0;'>LED Color:</p>";
-    html += "<select id='ledcolor' onchange=\"location.href='/style?ledcolor='+this.value\">";
-    html += "<option value='0'" + String(ledOnColor == COLOR_RED ? " selected" : "") + ">Red</option>";
-    html += "<option value='1'" + String(ledOnColor == COLOR_GREEN ? " selected" : "") + ">Green</option>";
-    html += "<option value='2'" + String(ledOnColor == COLOR_BLUE ? " selected" : "") + ">Blue</option>";
-    html += "<option value='3'" + String(ledOnColor == COLOR_YELLOW ? " selected" : "") + ">Yellow</option>";
-    html += "<option value='4'" + String(ledOnColor == COLOR_CYAN ? " selected" : "") + ">Cyan</option>";
-    html += "<option value='5'" + String(ledOnColor == COLOR_MAGENTA ? " selected" : "") + ">Magenta</option>";
-    html += "<option value='6'" + String(ledOnColor == COLOR_WHITE ? " selected" : "") + ">White</option>";
-    html += "<option value='7'" + String(ledOnColor == COLOR_ORANGE ? " selected" : "") + ">Orange</option>";
-    html += "</select><br>";
-    
-    html += "<p style='margin:8px 0 4px 0;'>Surround Color:</p>";
-    html += "<select id='surroundcolor' onchange=\"location.href='/style?surroundcolor='+this.value\">";
-    html += "<option value='0'" + String(ledSurroundColor == COLOR_WHITE ? " selected" : "") + ">White</option>";
-    html += "<option value='1'" + String(ledSurroundColor == COLOR_LIGHT_GRAY ? " selected" : "") + ">Light Gray</option>";
-    html += "<option value='2'" + String(ledSurroundColor == COLOR_DARK_GRAY ? " selected" : "") + ">Dark Gray</option>";
-    html += "<option value='3'" + String(ledSurroundColor == COLOR_RED ? " selected" : "") + ">Red</option>";
-    html += "<option value='4'" + String(ledSurroundColor == COLOR_GREEN ? " selected" : "") + ">Green</option>";
-    html += "<option value='5'" + String(ledSurroundColor == COLOR_BLUE ? " selected" : "") + ">Blue</option>";
-    html += "<option value='6'" + String(ledSurroundColor == COLOR_YELLOW ? " selected" : "") + ">Yellow</option>";
-    html += "<option value='7'" + String(ledSurroundColor == ledOnColor ? " selected" : "") + ">Match LED Color</option>";
-    html += "</select><br>";
-
-    html += "<p style='margin:8px 0 4px 0;'>LED Size: <span id='ledSizeValue'>" + String(ledSize) + "</span> pixels</p>";
-    html += "<input type='range' min='4' max='12' value='" + String(ledSize) + "' ";
-    html += "oninput=\"document.getElementById('ledSizeValue').textContent=this.value\" ";
-    html += "onchange=\"location.href='/style?ledsize='+this.value\" ";
-    html += "style='width:100%;'>";
-    html += "<small style='color:#888;display:block;margin:2px 0 8px 0;'>Range: 4-12 pixels (default: 9)</small>";
-
-    html += "<p style='margin:8px 0 4px 0;'>LED Spacing: <span id='ledSpacingValue'>" + String(ledSpacing) + "</span> pixels</p>";
-    html += "<input type='range' min='0' max='3' value='" + String(ledSpacing) + "' ";
-    html += "oninput=\"document.getElementById('ledSpacingValue').textContent=this.value\" ";
-    html += "onchange=\"location.href='/style?ledspacing='+this.value\" ";
-    html += "style='width:100%;'>";
-    html += "<small style='color:#888;display:block;margin:2px 0 8px 0;'>Range: 0-3 pixels (default: 1)</small>";
-
-    html += "<p style='margin:8px 0 4px 0;'>Mode Switch Interval: <span id='modeSwitchIntervalValue'>" + String(modeSwitchInterval) + "</span> seconds</p>";
-    html += "<input type='range' min='1' max='60' value='" + String(modeSwitchInterval) + "' ";
-    html += "oninput=\"document.getElementById('modeSwitchIntervalValue').textContent=this.value\" ";
-    html += "onchange=\"location.href='/modeinterval?seconds='+this.value\" ";
-    html += "style='width:100%;'>";
-    html += "<small style='color:#888;display:block;margin:2px 0;'>Range: 1-60 seconds (default: 5)</small>";
-    html += "</div>";
-    
-    html += "<div class='card'><h2>Timezone & Time Format</h2>";
-    html += "<p style='margin:8px 0 4px 0;'>Current Timezone: " + String(timezones[currentTimezone].name) + "</p>";
-    html += "<select id='tz' onchange=\"location.href='/timezone?tz='+this.value\" style='margin-bottom:8px;'>";
-
-    // Australia & Oceania (0-11)
-    html += "<optgroup label='Australia & Oceania'>";
-    for (int i = 0; i <= 11; i++) {
-      html += "<option value='" + String(i) + "'" + (i == currentTimezone ? " selected" : "") + ">";
-      html += timezones[i].name;
-      html += "</option>";
-    }
-    html += "</optgroup>";
-
-    // North America (12-22)
-    html += "<optgroup label='North America'>";
-    for (int i = 12; i <= 22; i++) {
-      html += "<option value='" + String(i) + "'" + (i == currentTimezone ? " selected" : "") + ">";
-      html += timezones[i].name;
-      html += "</option>";
-    }
-    html += "</optgroup>";
-
-    // South America (23-28)
-    html += "<optgroup label='South America'>";
-    for (int i = 23; i <= 28; i++) {
-      html += "<option value='" + String(i) + "'" + (i == currentTimezone ? " selected" : "") + ">";
-      html += timezones[i].name;
-      html += "</option>";
-    }
-    html += "</optgroup>";
-
-    // Western Europe (29-39)
-    html += "<optgroup label='Western Europe'>";
-    for (int i = 29; i <= 39; i++) {
-      html += "<option value='" + String(i) + "'" + (i == currentTimezone ? " selected" : "") + ">";
-      html += timezones[i].name;
-      html += "</option>";
-    }
-    html += "</optgroup>";
-
-    // Northern Europe (40-43)
-    html += "<optgroup label='Northern Europe'>";
-    for (int i = 40; i <= 43; i++) {
-      html += "<option value='" + String(i) + "'" + (i == currentTimezone ? " selected" : "") + ">";
-      html += timezones[i].name;
-      html += "</option>";
-    }
-    html += "</optgroup>";
-
-    // Central & Eastern Europe (44-51)
-    html += "<optgroup label='Central & Eastern Europe'>";
-    for (int i = 44; i <= 51; i++) {
-      html += "<option value='" + String(i) + "'" + (i == currentTimezone ? " selected" : "") + ">";
-      html += timezones[i].name;
-      html += "</option>";
-    }
-    html += "</optgroup>";
-
-    // Middle East (52-56)
-    html += "<optgroup label='Middle East'>";
-    for (int i = 52; i <= 56; i++) {
-      html += "<option value='" + String(i) + "'" + (i == currentTimezone ? " selected" : "") + ">";
-      html += timezones[i].name;
-      html += "</option>";
-    }
-    html += "</optgroup>";
-
-    // South Asia (57-63)
-    html += "<optgroup label='South Asia'>";
-    for (int i = 57; i <= 63; i++) {
-      html += "<option value='" + String(i) + "'" + (i == currentTimezone ? " selected" : "") + ">";
-      html += timezones[i].name;
-      html += "</option>";
-    }
-    html += "</optgroup>";
-
-    // Southeast Asia (64-70)
-    html += "<optgroup label='Southeast Asia'>";
-    for (int i = 64; i <= 70; i++) {
-      html += "<option value='" + String(i) + "'" + (i == currentTimezone ? " selected" : "") + ">";
-      html += timezones[i].name;
-      html += "</option>";
-    }
-    html += "</optgroup>";
-
-    // East Asia (71-76)
-    html += "<optgroup label='East Asia'>";
-    for (int i = 71; i <= 76; i++) {
-      html += "<option value='" + String(i) + "'" + (i == currentTimezone ? " selected" : "") + ">";
-      html += timezones[i].name;
-      html += "</option>";
-    }
-    html += "</optgroup>";
-
-    // Central Asia (77-79)
-    html += "<optgroup label='Central Asia'>";
-    for (int i = 77; i <= 79; i++) {
-      html += "<option value='" + String(i) + "'" + (i == currentTimezone ? " selected" : "") + ">";
-      html += timezones[i].name;
-      html += "</option>";
-    }
-    html += "</optgroup>";
-
-    // Caucasus (80-82)
-    html += "<optgroup label='Caucasus'>";
-    for (int i = 80; i <= 82; i++) {
-      html += "<option value='" + String(i) + "'" + (i == currentTimezone ? " selected" : "") + ">";
-      html += timezones[i].name;
-      html += "</option>";
-    }
-    html += "</optgroup>";
-
-    // Africa (83-86)
-    html += "<optgroup label='Africa'>";
-    for (int i = 83; i <= 86; i++) {
-      html += "<option value='" + String(i) + "'" + (i == currentTimezone ? " selected" : "") + ">";
-      html += timezones[i].name;
-      html += "</option>";
-    }
-    html += "</optgroup>";
-
-    html += "</select><br>";
-
-    html += "<p style='margin:8px 0 4px 0;'>Time Format: " + String(use24HourFormat ? "24-Hour" : "12-Hour") + "</p>";
-    html += "<button onclick=\"location.href='/timeformat?mode=toggle'\">Toggle 12/24 Hour</button><br>";
-
-    html += "<p style='margin:8px 0 4px 0;'>Leading Zero: " + String(showLeadingZero ? "ON (01:23)" : "OFF (1:23)") + "</p>";
-    html += "<button onclick=\"location.href='/leadingzero?mode=toggle'\">Toggle Leading Zero</button><br>";
-
-    html += "<p style='margin:8px 0 4px 0;'>Date Format:</p>";
-    html += "<select id='dateformat' onchange=\"location.href='/dateformat?format='+this.value\">";
-    html += "<option value='0'" + String(dateFormat == 0 ? " selected" : "") + ">DD/MM/YY (08/01/26)</option>";
-    html += "<option value='1'" + String(dateFormat == 1 ? " selected" : "") + ">MM/DD/YY (01/08/26)</option>";
-    html += "<option value='2'" + String(dateFormat == 2 ? " selected" : "") + ">YYYY-MM-DD (2026-01-08)</option>";
-    html += "<option value='3'" + String(dateFormat == 3 ? " selected" : "") + ">DD.MM.YYYY (08.01.2026)</option>";
-    html += "<option value='4'" + String(dateFormat == 4 ? " selected" : "") + ">MM.DD.YYYY (01.08.2026)</option>";
-    html += "</select>";
-    html += "<small style='color:#888;display:block;margin:2px 0 0 0;'>Note: Adjustment of LED Size may be needed for certain formats</small>";
-    html += "</div>";
-    
-    html += "<div class='card'><h2>System</h2>";
-    html += "<p style='margin:4px 0;'>Board: ESP32 CYD (ESP32-2432S028R)</p>";
-
-    // Sensor information inline
-    if (sensorAvailable) {
-      html += "<p style='margin:4px 0;'>Sensor: <strong style='color:#50C878;'>" + String(sensorType) + "</strong>";
-#ifdef USE_BME280
-      html += " (Temp/Humid/Press, 0x76/77)</p>";
-#elif defined(USE_SHT3X)
-      html += " (Temp/Humid, 0x44/45)</p>";
-#elif defined(USE_HTU21D)
-      html += " (Temp/Humid, 0x40)</p>";
-#endif
-    } else {
-      html += "<p style='margin:4px 0;'>Sensor: <span style='color:#FFA500;'>Not detected</span></p>";
-    }
-
-    html += "<div style='margin:6px 0;'>";
-    html += "<span class='status-pill'>OTA ENABLED</span>";
-    html += "<span class='status-subtext'>Use CYD-Clock.local or the device IP on port 3232 for wireless uploads</span>";
-    html += "</div>";
-    html += "<div class='note'>OTA uploads require the password set in code and in platformio.ini (--auth). Default is CYD_OTA_2024—update both together if you change it.</div>";
-    html += "<p style='margin:4px 0;'>IP: " + WiFi.localIP().toString() + "</p>";
-    html += "<p style='margin:4px 0;'>Uptime: " + String(millis() / 1000) + "s</p>";
-    html += "<p style='margin:4px 0;'>Free Heap: " + String(ESP.getFreeHeap()) + " bytes</p>";
-    html += "<button onclick=\"if(confirm('Reset WiFi?'))location.href='/reset'\" style='margin-top:8px;'>Reset WiFi</button>";
-    html += "</div>";
-
-    // Footer panel
-    html += "<div class='footer'>";
-    html += "<div class='footer-content'>";
-    html += "<a href='https://github.com/anthonyjclarke/CYD_TFT_RetroClock' target='_blank' class='footer-link'>GitHub</a>";
-    html += "<span class='footer-separator'>|</span>";
-    html += "<a href='https://bsky.app/profile/anthonyjclarke.bsky.social' target='_blank' class='footer-link'>Bluesky</a>";
-    html += "</div>";
-    html += "<div class='footer-content'>";
-    html += "<span style='color:#aaa;font-size:clamp(13px,3.5vw,15px);'>Built with</span>";
-    html += "<span class='footer-heart'>❤️</span>";
-    html += "<span style='color:#aaa;font-size:clamp(13px,3.5vw,15px);'>by Anthony Clarke</span>";
-    html += "</div>";
-    html += "<div class='footer-credit'>";
-    html += "Based on the original ESP8266 TFT LED Matrix Clock by ";
-    html += "<a href='https://www.youtube.com/watch?v=2wJOdi0xzas&t=32s' target='_blank'>@cbm80amiga</a>";
-    html += "</div>";
-    html += "</div>";
-
-    html += "</body></html>";
-    server.send(200, "text/html", html);
+  // Settings and status the dashboard fills in after loading
+  route("/api/config", [](HttpRequest& req) {
+    req.sendHeader("Cache-Control", "no-cache");
+    req.sendFormatted<formatConfigJson, 1024>(200, "application/json");
+  });
+
+  // Timezone names, indexed like timezones[]; only changes with the firmware
+  route("/api/timezones", [](HttpRequest& req) {
+    req.sendHeader("Cache-Control", "max-age=86400");
+    req.sendBody<fillTimezones>(200, "application/json", HTTP_LENGTH_UNKNOWN, HttpCursor());
   });
   
   // API endpoints
-  server.on("/api/time", []() {
-    String json = "{\"hours\":" + String(hours24) + ",\"minutes\":" + String(minutes) +
-                  ",\"seconds\":" + String(seconds) + ",\"day\":" + String(day) +
-                  ",\"month\":" + String(month) + ",\"year\":" + String(year) +
-                  ",\"use24hour\":" + String(use24HourFormat ? "true" : "false") +
-                  ",\"dateFormat\":" + String(dateFormat) + "}";
-    server.send(200, "application/json", json);
+  route("/api/time", [](HttpRequest& req) {
+    req.sendFormatted<formatTimeJson, 256>(200, "application/json");
+  });
+
+  // Sensor history: ?tier=0 (1-minute, default) or 1 (15-minute),
+  // optional ?from=/&to= epoch seconds. Binary, see fillHistoryTier().
+  route("/api/history", [](HttpRequest& req) {
+    int tier = req.hasArg("tier") ? req.arg("tier").toInt() : 0;
+    uint32_t from = req.hasArg("from") ? strtoul(req.arg("from").c_str(), NULL, 10) : 0;
+    uint32_t to = req.hasArg("to") ? strtoul(req.arg("to").c_str(), NULL, 10) : UINT32_MAX;
+    if (tier == 1) {
+      sendHistory(req, historyQuarters, 1, from, to);
+    } else {
+      sendHistory(req, historyMinutes, 0, from, to);
+    }
   });
+
+  // Health counters for Prometheus
+  route("/metrics", handleMetrics);
+
+  // Display push channel (Server-Sent Events)
+#if ASYNC_WEB_SERVER
+  eventSource.onConnect(handleEventsConnect);
+  server.addHandler(&eventSource);
+#else
+  route("/api/events", handleEventsSubscribe);
+#endif
   
   // Display buffer API endpoint
-  server.on("/api/display", []() {
-    String json = "{\"buffer\":[";
-    for (int i = 0; i < LINE_WIDTH * DISPLAY_ROWS; i++) {
-      json += String(scr[i]);
-      if (i < LINE_WIDTH * DISPLAY_ROWS - 1) json += ",";
-    }
-    json += "],\"width\":" + String(LINE_WIDTH) + ",\"height\":" + String(TOTAL_HEIGHT);
-    json += ",\"style\":" + String(displayStyle);
-    json += ",\"ledColor\":" + String(ledOnColor);
-    json += ",\"surroundColor\":" + String(ledSurroundColor) + "}";
-    server.send(200, "application/json", json);
+  route("/api/display", [](HttpRequest& req) {
+    // 64 values of at most "255," plus the fields after them
+    req.sendFormatted<formatDisplayJson, Matrix::SIZE * 4 + 128>(200, "application/json");
+  });
+
+  // Binary display frame (little-endian):
+  //   [0] version  [1] width  [2] height  [3] style
+  //   [4..5] ledColor  [6..7] surroundColor  [8..11] seq
+  //   [12..] column bytes (LINE_WIDTH bytes per 8-pixel row band)
+  // Answers 304 when ?since=<seq> or If-None-Match matches the current frame.
+  route("/api/display.bin", [](HttpRequest& req) {
+    frameChannel.update();
+    const FrameSnapshot& frame = frameChannel.front();
+
+    char etag[16];
+    snprintf(etag, sizeof(etag), "\"%lu\"", (unsigned long)frame.seq);
+    req.sendHeader("ETag", etag);
+    req.sendHeader("Cache-Control", "no-cache");
+
+    bool sinceMatches = req.hasArg("since") &&
+                        strtoul(req.arg("since").c_str(), NULL, 10) == frame.seq;
+    if (sinceMatches || req.header("If-None-Match") == etag) {
+      req.send(304);
+      return;
+    }
+
+    // The body is the frame as it is when sent, which may be newer than the tag
+    req.sendFormatted<formatDisplayFrame, DISPLAY_FRAME_HEADER + Matrix::SIZE>(200, "application/octet-stream");
+  });
+
+#if PERF_ENABLED
+  // Profiling histograms: times in microseconds, ledPixels/ledSpans as counts,
+  // then the power state (estCurrentMa is modelled, see POWER).
+  // ?reset=1 clears all probes after reporting.
+  route("/api/perf", [](HttpRequest& req) {
+    req.sendHeader("Cache-Control", "no-cache");
+    if (req.hasArg("reset")) {
+      req.sendFormatted<formatPerfJsonAndReset, 2048>(200, "application/json");
+    } else {
+      req.sendFormatted<formatPerfJson, 2048>(200, "application/json");
+    }
   });
+#endif
   
   // Temperature unit toggle
-  server.on("/temperature", []() {
-    if (server.hasArg("mode") && server.arg("mode") == "toggle") {
-      useFahrenheit = !useFahrenheit;
+  route("/temperature", [](HttpRequest& req) {
+    if (req.hasArg("mode") && req.arg("mode") == "toggle") {
+      displayState.useFahrenheit = !displayState.useFahrenheit;
+      publishDisplayState();
       settingsChanged = true;
-      DEBUG_SETTINGS(Serial.printf("=== SETTINGS CHANGED ===\nTemperature unit: %s\n", useFahrenheit ? "Fahrenheit" : "Celsius"));
+      markSettingsDirty();
+      DEBUG_SETTINGS(Serial.printf("=== SETTINGS CHANGED ===\nTemperature unit: %s\n", displayState.useFahrenheit ? "Fahrenheit" : "Celsius"));
     }
-    server.sendHeader("Location", "/");
-    server.send(302, "text/plain", "");
+    sendSettingsDone(req);
   });
 
   // Time format toggle
-  server.on("/timeformat", []() {
-    if (server.hasArg("mode") && server.arg("mode") == "toggle") {
-      use24HourFormat = !use24HourFormat;
+  route("/timeformat", [](HttpRequest& req) {
+    if (req.hasArg("mode") && req.arg("mode") == "toggle") {
+      displayState.use24HourFormat = !displayState.use24HourFormat;
+      publishDisplayState();
       settingsChanged = true;
+      markSettingsDirty();
       DEBUG_SETTINGS(Serial.printf("=== SETTINGS CHANGED ===\nTime format: %s\nLeading zero: %s\n",
-        use24HourFormat ? "24-hour" : "12-hour",
-        showLeadingZero ? "ON" : "OFF"));
+        displayState.use24HourFormat ? "24-hour" : "12-hour",
+        displayState.showLeadingZero ? "ON" : "OFF"));
     }
-    server.sendHeader("Location", "/");
-    server.send(302, "text/plain", "");
+    sendSettingsDone(req);
   });
 
   // Leading zero toggle
-  server.on("/leadingzero", []() {
-    if (server.hasArg("mode") && server.arg("mode") == "toggle") {
-      showLeadingZero = !showLeadingZero;
+  route("/leadingzero", [](HttpRequest& req) {
+    if (req.hasArg("mode") && req.arg("mode") == "toggle") {
+      displayState.showLeadingZero = !displayState.showLeadingZero;
+      publishDisplayState();
       settingsChanged = true;
+      markSettingsDirty();
       DEBUG_SETTINGS(Serial.printf("=== SETTINGS CHANGED ===\nLeading zero: %s\nTime format: %s\n",
-        showLeadingZero ? "ON" : "OFF",
-        use24HourFormat ? "24-hour" : "12-hour"));
+        displayState.showLeadingZero ? "ON" : "OFF",
+        displayState.use24HourFormat ? "24-hour" : "12-hour"));
     }
-    server.sendHeader("Location", "/");
-    server.send(302, "text/plain", "");
+    sendSettingsDone(req);
   });
 
   // Date format selector
-  server.on("/dateformat", []() {
-    if (server.hasArg("format")) {
-      int newFormat = server.arg("format").toInt();
+  route("/dateformat", [](HttpRequest& req) {
+    if (req.hasArg("format")) {
+      int newFormat = req.arg("format").toInt();
       if (newFormat >= 0 && newFormat <= 4) {
-        dateFormat = newFormat;
+        displayState.dateFormat = newFormat;
         settingsChanged = true;
+        markSettingsDirty();
         const char* formatNames[] = {"DD/MM/YY", "MM/DD/YY", "YYYY-MM-DD", "DD.MM.YYYY", "MM.DD.YYYY"};
-        DEBUG_SETTINGS(Serial.printf("=== SETTINGS CHANGED ===\nDate format: %s\n", formatNames[dateFormat]));
+        DEBUG_SETTINGS(Serial.printf("=== SETTINGS CHANGED ===\nDate format: %s\n", formatNames[displayState.dateFormat]));
 
         // Redraw display with new format
-        tft.fillScreen(BG_COLOR);
-        forceFullRedraw = true;
-        switch (currentMode) {
-          case 0: displayTimeAndTemp(); break;
-          case 1: displayTimeLarge(); break;
-          case 2: displayTimeAndDate(); break;
-        }
-        refreshAll();
+        displayState.redrawSeq++;
+        publishDisplayState();
       }
     }
-    server.sendHeader("Location", "/");
-    server.send(302, "text/plain", "");
+    sendSettingsDone(req);
   });
 
   // Mode switch interval
-  server.on("/modeinterval", []() {
-    if (server.hasArg("seconds")) {
-      int newInterval = server.arg("seconds").toInt();
+  route("/modeinterval", [](HttpRequest& req) {
+    if (req.hasArg("seconds")) {
+      int newInterval = req.arg("seconds").toInt();
       if (newInterval >= 1 && newInterval <= 60) {
-        modeSwitchInterval = newInterval;
+        displayState.modeSwitchInterval = newInterval;
+        publishDisplayState();
         settingsChanged = true;
-        DEBUG_SETTINGS(Serial.printf("=== SETTINGS CHANGED ===\nMode switch interval: %d seconds\n", modeSwitchInterval));
+        markSettingsDirty();
+        DEBUG_SETTINGS(Serial.printf("=== SETTINGS CHANGED ===\nMode switch interval: %d seconds\n", displayState.modeSwitchInterval));
       }
     }
-    server.sendHeader("Location", "/");
-    server.send(302, "text/plain", "");
+    sendSettingsDone(req);
   });
 
   // Timezone selection
-  server.on("/timezone", []() {
-    if (server.hasArg("tz")) {
-      int tz = server.arg("tz").toInt();
+  route("/timezone", [](HttpRequest& req) {
+    if (req.hasArg("tz")) {
+      int tz = req.arg("tz").toInt();
       if (tz >= 0 && tz < numTimezones) {
         currentTimezone = tz;
-        syncNTP();
+        applyTimezone();  // Offset change only; NTP keeps its own schedule
+        displayState.clockSeq++;
+        publishDisplayState();
         settingsChanged = true;
+        markSettingsDirty();
         DEBUG_SETTINGS(Serial.printf("=== SETTINGS CHANGED ===\nTimezone: %s\n", timezones[currentTimezone].name));
       }
     }
-    server.sendHeader("Location", "/");
-    server.send(302, "text/plain", "");
+    sendSettingsDone(req);
   });
   
   // Style settings
-  server.on("/style", []() {
+  route("/style", [](HttpRequest& req) {
     bool changed = false;
     String changeDetails = "=== SETTINGS CHANGED ===\n";
 
-    if (server.hasArg("mode") && server.arg("mode") == "toggle") {
-      displayStyle = (displayStyle + 1) % 2;
+    if (req.hasArg("mode") && req.arg("mode") == "toggle") {
+      displayState.displayStyle = (displayState.displayStyle + 1) % 2;
       changed = true;
-      changeDetails += "Display style: " + String(displayStyle == 0 ? "Default (Blocks)" : "Realistic (LEDs)") + "\n";
+      changeDetails += "Display style: " + String(displayState.displayStyle == 0 ? "Default (Blocks)" : "Realistic (LEDs)") + "\n";
     }
 
-    if (server.hasArg("ledcolor")) {
-      int colorIdx = server.arg("ledcolor").toInt();
+    if (req.hasArg("ledcolor")) {
+      int colorIdx = req.arg("ledcolor").toInt();
       String colorName;
       switch(colorIdx) {
-        case 0: ledOnColor = COLOR_RED; colorName = "Red"; break;
-        case 1: ledOnColor = COLOR_GREEN; colorName = "Green"; break;
-        case 2: ledOnColor = COLOR_BLUE; colorName = "Blue"; break;
-        case 3: ledOnColor = COLOR_YELLOW; colorName = "Yellow"; break;
-        case 4: ledOnColor = COLOR_CYAN; colorName = "Cyan"; break;
-        case 5: ledOnColor = COLOR_MAGENTA; colorName = "Magenta"; break;
-        case 6: ledOnColor = COLOR_WHITE; colorName = "White"; break;
-        case 7: ledOnColor = COLOR_ORANGE; colorName = "Orange"; break;
-        default: ledOnColor = COLOR_RED; colorName = "Red";
+        case 0: displayState.ledOnColor = COLOR_RED; colorName = "Red"; break;
+        case 1: displayState.ledOnColor = COLOR_GREEN; colorName = "Green"; break;
+        case 2: displayState.ledOnColor = COLOR_BLUE; colorName = "Blue"; break;
+        case 3: displayState.ledOnColor = COLOR_YELLOW; colorName = "Yellow"; break;
+        case 4: displayState.ledOnColor = COLOR_CYAN; colorName = "Cyan"; break;
+        case 5: displayState.ledOnColor = COLOR_MAGENTA; colorName = "Magenta"; break;
+        case 6: displayState.ledOnColor = COLOR_WHITE; colorName = "White"; break;
+        case 7: displayState.ledOnColor = COLOR_ORANGE; colorName = "Orange"; break;
+        default: displayState.ledOnColor = COLOR_RED; colorName = "Red";
       }
-      ledOffColor = ledOnColor >> 3;
+      displayState.ledOffColor = displayState.ledOnColor >> 3;
 
       if (surroundMatchesLED) {
-        ledSurroundColor = ledOnColor;
+        displayState.ledSurroundColor = displayState.ledOnColor;
       }
 
       changed = true;
       changeDetails += "LED color: " + colorName + "\n";
     }
 
-    if (server.hasArg("surroundcolor")) {
-      int colorIdx = server.arg("surroundcolor").toInt();
+    if (req.hasArg("surroundcolor")) {
+      int colorIdx = req.arg("surroundcolor").toInt();
       String colorName;
       switch(colorIdx) {
         case 0:
-          ledSurroundColor = COLOR_WHITE;
+          displayState.ledSurroundColor = COLOR_WHITE;
           surroundMatchesLED = false;
           colorName = "White";
           break;
         case 1:
-          ledSurroundColor = COLOR_LIGHT_GRAY;
+          displayState.ledSurroundColor = COLOR_LIGHT_GRAY;
           surroundMatchesLED = false;
           colorName = "Light Gray";
           break;
         case 2:
-          ledSurroundColor = COLOR_DARK_GRAY;
+          displayState.ledSurroundColor = COLOR_DARK_GRAY;
           surroundMatchesLED = false;
           colorName = "Dark Gray";
           break;
         case 3:
-          ledSurroundColor = COLOR_RED;
+          displayState.ledSurroundColor = COLOR_RED;
           surroundMatchesLED = false;
           colorName = "Red";
           break;
         case 4:
-          ledSurroundColor = COLOR_GREEN;
+          displayState.ledSurroundColor = COLOR_GREEN;
           surroundMatchesLED = false;
           colorName = "Green";
           break;
         case 5:
-          ledSurroundColor = COLOR_BLUE;
+          displayState.ledSurroundColor = COLOR_BLUE;
           surroundMatchesLED = false;
           colorName = "Blue";
           break;
         case 6:
-          ledSurroundColor = COLOR_YELLOW;
+          displayState.ledSurroundColor = COLOR_YELLOW;
           surroundMatchesLED = false;
           colorName = "Yellow";
           break;
         case 7:
-          ledSurroundColor = ledOnColor;
+          displayState.ledSurroundColor = displayState.ledOnColor;
           surroundMatchesLED = true;
           colorName = "Match LED";
           break;
         default:
-          ledSurroundColor = COLOR_WHITE;
+          displayState.ledSurroundColor = COLOR_WHITE;
           surroundMatchesLED = false;
           colorName = "White";
       }
@@ -1715,81 +4280,105 @@ void setupWebServer() {
       changeDetails += "Surround color: " + colorName + "\n";
     }
 
-    if (server.hasArg("ledsize")) {
-      int newSize = server.arg("ledsize").toInt();
+    if (req.hasArg("ledsize")) {
+      int newSize = req.arg("ledsize").toInt();
       if (newSize >= 4 && newSize <= 12) {  // Reasonable range: 4-12 pixels
-        ledSize = newSize;
+        displayState.ledSize = newSize;
         changed = true;
-        changeDetails += "LED size: " + String(ledSize) + "px\n";
+        changeDetails += "LED size: " + String(displayState.ledSize) + "px\n";
       }
     }
 
-    if (server.hasArg("ledspacing")) {
-      int newSpacing = server.arg("ledspacing").toInt();
+    if (req.hasArg("ledspacing")) {
+      int newSpacing = req.arg("ledspacing").toInt();
       if (newSpacing >= 0 && newSpacing <= 3) {  // Reasonable range: 0-3 pixels
-        ledSpacing = newSpacing;
+        displayState.ledSpacing = newSpacing;
         changed = true;
-        changeDetails += "LED spacing: " + String(ledSpacing) + "px\n";
+        changeDetails += "LED spacing: " + String(displayState.ledSpacing) + "px\n";
       }
     }
 
     if (changed) {
       settingsChanged = true;
+      markSettingsDirty();
       DEBUG_SETTINGS(Serial.print(changeDetails.c_str()));
 
-      tft.fillScreen(BG_COLOR);
-      forceFullRedraw = true;
-
-      switch (currentMode) {
-        case 0: displayTimeAndTemp(); break;
-        case 1: displayTimeLarge(); break;
-        case 2: displayTimeAndDate(); break;
-      }
-      refreshAll();
+      // Render task rebuilds LED bitmaps and redraws everything
+      displayState.redrawSeq++;
+      publishDisplayState();
     }
     
-    server.sendHeader("Location", "/");
-    server.send(302, "text/plain", "");
+    sendSettingsDone(req);
   });
 
   // Display rotation toggle
-  server.on("/rotation", []() {
-    if (server.hasArg("mode") && server.arg("mode") == "toggle") {
-      displayRotation = (displayRotation == 1) ? 3 : 1;
+  route("/rotation", [](HttpRequest& req) {
+    if (req.hasArg("mode") && req.arg("mode") == "toggle") {
+      displayState.displayRotation = (displayState.displayRotation == 1) ? 3 : 1;
       settingsChanged = true;
+      markSettingsDirty();
       DEBUG_SETTINGS(Serial.printf("=== SETTINGS CHANGED ===\nDisplay rotation: %s\n",
-        displayRotation == 1 ? "Normal" : "Flipped 180°"));
+        displayState.displayRotation == 1 ? "Normal" : "Flipped 180°"));
 
-      // Update TFT rotation and redraw
-      tft.setRotation(displayRotation);
-      tft.fillScreen(BG_COLOR);
-      forceFullRedraw = true;
+      // Render task updates TFT rotation and redraws
+      displayState.redrawSeq++;
+      publishDisplayState();
+    }
+    sendSettingsDone(req);
+  });
 
-      switch (currentMode) {
-        case 0: displayTimeAndTemp(); break;
-        case 1: displayTimeLarge(); break;
-        case 2: displayTimeAndDate(); break;
-      }
-      refreshAll();
+  // Fleet sync: ?role=0 (standalone), 1 (leader) or 2 (follower), ?mirror=0|1
+  route("/fleet", [](HttpRequest& req) {
+    if (req.hasArg("role")) {
+      int role = req.arg("role").toInt();
+      if (role >= FLEET_STANDALONE && role <= FLEET_FOLLOWER) fleetRole = role;
+    }
+    if (req.hasArg("mirror")) fleetMirror = req.arg("mirror").toInt() != 0;
+    settingsChanged = true;
+    markSettingsDirty();  // serviceFleet() switches roles on its next pass
+    DEBUG_SETTINGS(Serial.printf("=== SETTINGS CHANGED ===\nFleet role: %d, mirror: %s\n",
+      fleetRole, fleetMirror ? "ON" : "OFF"));
+    sendSettingsDone(req);
+  });
+
+  // Night mode: ?trigger=0 (off), 1 (schedule), 2 (dark) or 3 (either), ?start=/&end=, ?brightness=
+  route("/night", [](HttpRequest& req) {
+    if (req.hasArg("trigger")) {
+      int trigger = req.arg("trigger").toInt();
+      if (trigger >= NIGHT_OFF && trigger <= NIGHT_EITHER) nightTrigger = trigger;
     }
-    server.sendHeader("Location", "/");
-    server.send(302, "text/plain", "");
+    if (req.hasArg("start")) nightStart = constrain(req.arg("start").toInt(), 0, 23);
+    if (req.hasArg("end")) nightEnd = constrain(req.arg("end").toInt(), 0, 23);
+    if (req.hasArg("brightness")) nightBrightness = constrain(req.arg("brightness").toInt(), 0, 255);
+    powerTimer();  // Enter or leave night mode now rather than on the next check
+    settingsChanged = true;
+    markSettingsDirty();
+    DEBUG_SETTINGS(Serial.printf("=== SETTINGS CHANGED ===\nNight mode: trigger %d, %02d-%02d, backlight %d\n",
+      nightTrigger, nightStart, nightEnd, nightBrightness));
+    sendSettingsDone(req);
   });
 
+  // Firmware upload (see FIRMWARE UPDATE)
+  routeUpload("/update", handleFirmwareDone, handleFirmwareUpload);
+
   // Reset WiFi
-  server.on("/reset", []() {
-    server.send(200, "text/html", 
+  route("/reset", [](HttpRequest& req) {
+    req.send(200, "text/html",
       "<html><body><h1>WiFi Reset</h1><p>WiFi settings cleared. Device will restart...</p></body></html>");
-    delay(1000);
-    wifiManager.resetSettings();
-    ESP.restart();
+    wifiResetAt = millis() | 1;  // Network task resets once the page is out (0 = none)
   });
   
   // Handle not found
-  server.onNotFound([]() {
-    server.send(404, "text/plain", "Not Found");
+  route(nullptr, [](HttpRequest& req) {
+    req.send(404, "text/plain", "Not Found");
   });
   
+#if !ASYNC_WEB_SERVER
+  // Needed for conditional GETs on / and /api/display.bin, and sendSettingsDone()
+  const char* headerKeys[] = {"If-None-Match", "X-Requested-With"};
+  server.collectHeaders(headerKeys, 2);
+#endif
+
   server.begin();
   DEBUG(Serial.println("\n=== Web Server Started ==="));
   DEBUG(Serial.print("Server running at http://"));
@@ -1805,126 +4394,65 @@ void setupWebServer() {
 // ======================== FORWARD DECLARATIONS ========================
 void configModeCallback(WiFiManager* myWiFiManager);
 
-// ======================== SETUP ========================
-
-void setup() {
-  Serial.begin(115200);
-  delay(1000);
-  
-  DEBUG(Serial.println("\n\n╔════════════════════════════════════════╗"));
-  DEBUG(Serial.println("║   ESP32 CYD TFT Matrix Clock v3.6      ║"));
-  DEBUG(Serial.println("║   Cheap Yellow Display Edition         ║"));
-  DEBUG(Serial.println("╚════════════════════════════════════════╝\n"));
-
-  // Initialize boot button
-  pinMode(BOOT_BTN_PIN, INPUT_PULLUP);
-
-  // Initialize RGB LED pins
-  pinMode(LED_R_PIN, OUTPUT);
-  pinMode(LED_G_PIN, OUTPUT);
-  pinMode(LED_B_PIN, OUTPUT);
-  setRGBLed(false, false, false);  // All off initially
-
-  // Check if BOOT button is pressed during startup to reset WiFi
-  bool resetWiFi = false;
-  if (digitalRead(BOOT_BTN_PIN) == LOW) {
-    DEBUG(Serial.println("\n⚠️  BOOT button pressed - checking for WiFi reset..."));
-    setRGBLed(1, 1, 0);  // Yellow LED to indicate button detected
-
-    // Wait for button to be held for 3 seconds
-    unsigned long pressStart = millis();
-    while (digitalRead(BOOT_BTN_PIN) == LOW && (millis() - pressStart) < 3000) {
-      delay(100);
-    }
-
-    if (millis() - pressStart >= 3000) {
-      resetWiFi = true;
-      DEBUG(Serial.println("✓ BOOT button held for 3 seconds - WiFi will be reset!"));
-      setRGBLed(1, 0, 0);  // Red LED
-      delay(500);
-    } else {
-      DEBUG(Serial.println("✗ Button released too early - WiFi will not be reset"));
-      setRGBLed(false, false, false);
-    }
-  }
+// ======================== BACKGROUND BRING-UP ========================
+// setup() only restores settings and the clock and starts the display, so
+// a known time is on screen within a few hundred ms of reset. WiFi, the
+// sensor, NTP, the web server and OTA are brought up here, on the network
+// task, while the render task is already showing the clock.
 
-  // Flash blue to indicate startup
-  flashRGBLed(0, 0, 1, 500);
-  
-  // Initialize TFT display
-  initTFT();
+bool resetWiFiRequested = false;  // BOOT button held at power-up
 
-  showMessage("INIT");
+// True if the WiFi driver holds credentials from an earlier connection
+bool hasSavedWiFi() {
+  wifi_config_t config;
+  if (esp_wifi_get_config(WIFI_IF_STA, &config) != ESP_OK) return false;
+  return config.sta.ssid[0] != '\0';
+}
 
-  // Show reset WiFi message if button was held
-  if (resetWiFi) {
-    delay(500);
-    showMessage("RESET");
-    delay(500);
-    showMessage("WIFI");
-    delay(1000);
-  }
-  
-  // Test sensor
-  sensorAvailable = testSensor();
-  if (sensorAvailable) {
-    updateSensorData();
-    // Flash green if sensor found
-    flashRGBLed(0, 1, 0);
-  } else {
-    // Flash yellow (red+green) if no sensor
-    flashRGBLed(1, 1, 0);
-  }
-  
-  // WiFi setup
+// Start associating with the saved network; returns at once
+void beginWiFi() {
   wifiManager.setAPCallback(configModeCallback);
   wifiManager.setTimeout(180);
 
-  // Reset WiFi if button was held during boot
-  if (resetWiFi) {
+  WiFi.mode(WIFI_STA);
+  setRGBLed(0, 0, 1);  // Blue while connecting
+
+  if (resetWiFiRequested) {
     DEBUG(Serial.println("\n🔄 Resetting WiFi credentials..."));
-    showMessage("WIFI RST");
     wifiManager.resetSettings();
-    delay(1000);
     DEBUG(Serial.println("✓ WiFi credentials cleared!"));
+  } else if (hasSavedWiFi()) {
+    WiFi.begin();
   }
+}
 
-  showMessage("WIFI");
-  // Set LED to blue during WiFi connection
-  setRGBLed(0, 0, 1);
-  
-  if (!wifiManager.autoConnect("CYD_Clock_Setup")) {
-    DEBUG(Serial.println("Failed to connect, restarting..."));
-    // Flash red on failure
-    for (int i = 0; i < 5; i++) {
-      flashRGBLed(1, 0, 0, 200);
-      delay(200);
+// Wait for the connection started by beginWiFi(), falling back to the
+// WiFiManager config portal. Only blocks the network task.
+void finishWiFi() {
+  if (!resetWiFiRequested && hasSavedWiFi()) {
+    unsigned long start = millis();
+    while (WiFi.status() != WL_CONNECTED && millis() - start < WIFI_CONNECT_TIMEOUT) {
+      vTaskDelay(pdMS_TO_TICKS(50));
     }
-    ESP.restart();
-  }
-  
-  setRGBLed(false, false, false);  // Turn off LED
-
-  // Ensure we're in station mode after WiFiManager
-  WiFi.mode(WIFI_STA);
-
-  // Wait a moment for WiFi to stabilize
-  delay(500);
-
-  // Verify connection stability
-  int retries = 0;
-  while (WiFi.status() != WL_CONNECTED && retries < 10) {
-    delay(500);
-    retries++;
-    DEBUG(Serial.print("."));
   }
-  DEBUG(Serial.println());
 
   if (WiFi.status() != WL_CONNECTED) {
-    DEBUG(Serial.println("WiFi connection lost! Restarting..."));
-    ESP.restart();
+    if (!wifiManager.autoConnect("CYD_Clock_Setup")) {
+      DEBUG(Serial.println("Failed to connect, restarting..."));
+      // Flash red on failure
+      for (int i = 0; i < 5; i++) {
+        flashRGBLed(1, 0, 0, 200);
+        delay(200);
+      }
+      ESP.restart();
+    }
+    // Ensure we're in station mode after WiFiManager
+    WiFi.mode(WIFI_STA);
   }
 
+  setRGBLed(false, false, false);
+  startWiFiSupervision();
+
   DEBUG(Serial.println("\n=== WiFi Connected ==="));
   DEBUG(Serial.print("SSID: "));
   DEBUG(Serial.println(WiFi.SSID()));
@@ -1941,132 +4469,295 @@ void setup() {
   DEBUG(Serial.println(" dBm"));
   DEBUG(Serial.print("WiFi Mode: "));
   DEBUG(Serial.println(WiFi.getMode() == WIFI_STA ? "STA" : "Other"));
+}
 
-  showMessage("WIFI OK");
-  flashRGBLed(0, 1, 0);  // Green flash for success
-  delay(1000);
-
-  // Display IP address split across two rows
-  String ipStr = WiFi.localIP().toString();
-  showIPAddress(ipStr.c_str());
-  delay(2500);  // Pause for 2.5 seconds to allow user to see IP address
-  
-  // Sync time
-  showMessage("NTP");
-  syncNTP();
-  showMessage("TIME OK");
-  delay(1000);
-  
-  // Start web server
-  setupWebServer();
-
-  // Setup OTA (Over-The-Air) updates
-  ArduinoOTA.setHostname("CYD-Clock");
-  ArduinoOTA.setPassword("CYD_OTA_2024");  // Change this to a secure password
+// ArduinoOTA.handle() runs outside the network lock (an espota upload keeps
+// it busy throughout), so each callback locks around the state it changes.
+void setupOTA() {
+  ArduinoOTA.setHostname(OTA_HOSTNAME);
+  ArduinoOTA.setPassword(OTA_PASSWORD);
 
   ArduinoOTA.onStart([]() {
     String type = (ArduinoOTA.getCommand() == U_FLASH) ? "sketch" : "filesystem";
     DEBUG(Serial.println("OTA Update Start: " + type));
-    showMessage("OTA");
+    NetworkLock lock;
+    beginUpdateDisplay();
   });
 
   ArduinoOTA.onEnd([]() {
     DEBUG(Serial.println("\nOTA Update Complete"));
-    showMessage("OTA OK");
+    {
+      NetworkLock lock;
+      postMessage("OTA OK", 0);
+    }
     delay(1000);
   });
 
   ArduinoOTA.onProgress([](unsigned int progress, unsigned int total) {
-    unsigned int percent = (progress / (total / 100));
-    DEBUG(Serial.printf("OTA Progress: %u%%\r", percent));
-    if (percent % 10 == 0) {  // Update display every 10%
-      char msg[16];
-      sprintf(msg, "OTA %d%%", percent);
-      showMessage(msg);
-    }
+    int percent = total ? (int)((uint64_t)progress * 100 / total) : 0;
+    NetworkLock lock;
+    if (percent == updateShownPercent) return;  // Called per packet; only act on a new percentage
+    DEBUG(Serial.printf("OTA Progress: %d%%\r", percent));
+    showUpdateProgress(percent);
   });
 
   ArduinoOTA.onError([](ota_error_t error) {
+    {
+      NetworkLock lock;
+      postMessage("OTA ERR", 2000);
+      flashRGBLed(1, 0, 0);  // Red flash for error
+    }
     DEBUG(Serial.printf("OTA Error[%u]: ", error));
     if (error == OTA_AUTH_ERROR) DEBUG(Serial.println("Auth Failed"));
     else if (error == OTA_BEGIN_ERROR) DEBUG(Serial.println("Begin Failed"));
     else if (error == OTA_CONNECT_ERROR) DEBUG(Serial.println("Connect Failed"));
     else if (error == OTA_RECEIVE_ERROR) DEBUG(Serial.println("Receive Failed"));
     else if (error == OTA_END_ERROR) DEBUG(Serial.println("End Failed"));
-    showMessage("OTA ERR");
-    flashRGBLed(1, 0, 0);  // Red flash for error
     delay(2000);
   });
 
   ArduinoOTA.begin();
-  DEBUG(Serial.println("OTA Ready - Hostname: CYD-Clock"));
+  DEBUG(Serial.println("OTA Ready - Hostname: " OTA_HOSTNAME));
   DEBUG(Serial.print("OTA IP Address: "));
   DEBUG(Serial.println(WiFi.localIP()));
+}
 
-  showMessage("READY");
-  delay(1000);
+// Network task, before its main loop
+void bringUpNetwork() {
+  beginWiFi();
 
-  // Initialize display with current time
-  clearScreen();
-  tft.fillScreen(BG_COLOR);
-  updateTime();
+  // Probe the sensor while WiFi associates
+  detectSensor();
+  publishDisplayState();
+  startSensorRead();
+
+  finishWiFi();
 
-  lastNTPSync = millis();
-  lastSensorUpdate = millis();
-  lastStatusPrint = millis();
-  lastModeSwitch = millis();
+  // Overlays the clock briefly; with no valid time yet it stays up until NTP answers
+  postMessage(WiFi.localIP().toString().c_str(), IP_MESSAGE_HOLD_MS, true);
+
+  startNTPSync();
+  powerBegin();
+  setupWebServer();
+  setupOTA();
 }
 
-// ======================== MAIN LOOP ========================
+// ======================== TASKS ========================
 
-void loop() {
-  // Handle OTA updates
-  ArduinoOTA.handle();
+// Render task: sole owner of scr and the TFT.
+// Sleeps until the seconds tick or a published DisplayState wakes it; only
+// polls (every tick) while a DMA flush is still in flight.
+void renderTask(void* param) {
+  startSecondTick();
 
-  // Handle web server clients - this is critical for ESP32
-  server.handleClient();
-  yield();  // Allow background tasks to run
-  
-  unsigned long now = millis();
-  
-  // Update time
+  // Draw the first face now rather than at the next second boundary
+  if (displayStateChannel.update()) {
+    applyDisplayState(displayStateChannel.front());
+  }
   updateTime();
 
-  // Update sensor data
-  if (sensorAvailable && now - lastSensorUpdate >= SENSOR_UPDATE_INTERVAL) {
-    updateSensorData();
-    lastSensorUpdate = now;
+  for (;;) {
+    // Sleep until notified, the next animation frame, or (while flushing) 1 tick
+    TickType_t wait = animationWaitTicks();
+    if (!framebufferIdle() && wait > 1) wait = 1;
+    ulTaskNotifyTake(pdTRUE, wait);
+
+    if (displayStateChannel.update()) {
+      applyDisplayState(displayStateChannel.front());
+    }
+
+    if (secondTickPending.exchange(false, std::memory_order_acquire)) {
+      PERF_RECORD(PERF_WAKE_LATENCY, tickLatencyUs());
+      updateTime();
+    }
+
+    serviceMirror();
+
+    serviceAnimation();
+
+#if FRAMEBUFFER_RENDER
+    // Keep any asynchronous display flush moving
+    framebufferService();
+#endif
   }
-  
-  // Periodic NTP sync
-  if (now - lastNTPSync >= NTP_SYNC_INTERVAL) {
-    syncNTP();
-    lastNTPSync = now;
+}
+
+// Network task timers, run outside the network lock; each takes it for what it shares
+void sensorTimer() {
+  startSensorRead();
+}
+
+void ntpTimer() {
+  // Non-blocking, result is picked up by serviceNTP
+  NetworkLock lock;
+  startNTPSync();
+}
+
+// Serial status line; nothing to do in release builds
+void statusTimer() {
+#if DEBUG_ENABLED
+  time_t t = time(nullptr);
+  struct tm timeinfo;
+  localtime_r(&t, &timeinfo);
+  int temperature, humidity;
+  {
+    NetworkLock lock;
+    temperature = displayState.temperature;
+    humidity = displayState.humidity;
   }
-  
-  // Print status
-  if (now - lastStatusPrint >= STATUS_PRINT_INTERVAL) {
-    DEBUG(Serial.printf("Time: %02d:%02d | Date: %02d/%02d/%04d | Temp: %d°C | Hum: %d%% | Heap: %d\n",
-                        hours24, minutes, day, month, year, temperature, humidity, ESP.getFreeHeap()));
-    DEBUG(Serial.printf("WiFi Status: %s | IP: %s | RSSI: %d dBm\n",
-                        WiFi.status() == WL_CONNECTED ? "Connected" : "DISCONNECTED",
-                        WiFi.localIP().toString().c_str(),
-                        WiFi.RSSI()));
-    lastStatusPrint = now;
-  }
-
-  // Check WiFi connection and reconnect if needed
-  if (WiFi.status() != WL_CONNECTED) {
-    DEBUG(Serial.println("WiFi disconnected! Attempting to reconnect..."));
-    WiFi.reconnect();
-    delay(5000);
-    if (WiFi.status() != WL_CONNECTED) {
-      DEBUG(Serial.println("Reconnection failed. Restarting..."));
-      ESP.restart();
+  DEBUG(Serial.printf("Time: %02d:%02d | Date: %02d/%02d/%04d | Temp: %d°C | Hum: %d%% | Heap: %d\n",
+                      timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_mday, timeinfo.tm_mon + 1,
+                      timeinfo.tm_year + 1900, temperature, humidity, ESP.getFreeHeap()));
+  DEBUG(Serial.printf("WiFi Status: %s | IP: %s | RSSI: %d dBm\n",
+                      WiFi.status() == WL_CONNECTED ? "Connected" : "DISCONNECTED",
+                      WiFi.localIP().toString().c_str(),
+                      WiFi.RSSI()));
+#endif
+}
+
+DeadlineScheduler<5> networkTimers;
+
+// Runs one network task step under the network lock
+void locked(void (*step)()) {
+  NetworkLock lock;
+  step();
+}
+
+// Network task: web server, OTA, sensors, NTP and WiFi supervision. Web
+// handlers on the AsyncTCP task get in between the steps: each holds the
+// network lock only while it touches shared state.
+void networkTask(void* param) {
+  bringUpNetwork();
+
+  uint32_t now = millis();
+  networkTimers.add(sensorTimer, SENSOR_UPDATE_INTERVAL, now);
+  networkTimers.add(ntpTimer, NTP_SYNC_INTERVAL, now);
+  networkTimers.add(statusTimer, STATUS_PRINT_INTERVAL, now);
+  networkTimers.add(settingsTimer, 1000, now);
+  networkTimers.add(powerTimer, POWER_CHECK_INTERVAL, now);
+
+  for (;;) {
+    // Handle OTA updates (its callbacks lock, see setupOTA())
+    ArduinoOTA.handle();
+
+#if !ASYNC_WEB_SERVER
+    // Handle web server clients - a slow client only stalls this core
+    {
+      PERF_SCOPE(PERF_HANDLE_CLIENT);
+      server.handleClient();
     }
+#endif
+    locked(serviceWiFi);
+    serviceEvents();   // Sends outside the lock
+    locked(serviceFleet);
+    serviceSensor();   // Locks to publish
+    locked(serviceNTP);
+    locked(serviceRGBLed);
+
+    {
+      NetworkLock lock;
+
+      // /reset has been answered; clear the credentials and start over
+      if (wifiResetAt != 0 && millis() - wifiResetAt >= 1000) {
+        wifiManager.resetSettings();
+        ESP.restart();
+      }
+
+      // New firmware is in and the reply has gone
+      if (restartAt != 0 && millis() - restartAt >= UPDATE_RESTART_DELAY_MS) {
+        ESP.restart();
+      }
+    }
+
+    uint32_t waitMs = networkTimers.run(millis());
+
+    // Sleep until the next timer, but keep polling OTA (and the blocking web server)
+    vTaskDelay(pdMS_TO_TICKS(min(waitMs, networkPollMs())));
   }
+}
+
+void startTasks() {
+#if ASYNC_WEB_SERVER
+  networkMutex = xSemaphoreCreateRecursiveMutex();
+#endif
+  xTaskCreatePinnedToCore(renderTask, "render", TASK_STACK_SIZE, nullptr, 2,
+                          &renderTaskHandle, RENDER_TASK_CORE);
+  xTaskCreatePinnedToCore(networkTask, "network", TASK_STACK_SIZE, nullptr, 1,
+                          &networkTaskHandle, NETWORK_TASK_CORE);
+  DEBUG(Serial.printf("Tasks started: render on core %d, network on core %d\n",
+                      RENDER_TASK_CORE, NETWORK_TASK_CORE));
+}
+
+// ======================== SETUP ========================
+
+void setup() {
+  // No wait for the serial monitor: boot output is a nicety, the clock isn't
+  Serial.begin(115200);
   
-  delay(1);  // Minimal delay - ESP32 handles this well
+  DEBUG(Serial.println("\n\n╔════════════════════════════════════════╗"));
+  DEBUG(Serial.println("║   ESP32 CYD TFT Matrix Clock v3.6      ║"));
+  DEBUG(Serial.println("║   Cheap Yellow Display Edition         ║"));
+  DEBUG(Serial.println("╚════════════════════════════════════════╝\n"));
+
+  // Restore saved settings, then seed the network-side copy from them
+  loadSettings();
+  captureDisplayState();
+
+  // Local time is needed before NTP has configured the timezone
+  applyTimezone();
+  bool clockValid = restoreRetainedClock();
+
+  // Initialize boot button
+  pinMode(BOOT_BTN_PIN, INPUT_PULLUP);
+
+  // Initialize RGB LED pins
+  pinMode(LED_R_PIN, OUTPUT);
+  pinMode(LED_G_PIN, OUTPUT);
+  pinMode(LED_B_PIN, OUTPUT);
+  setRGBLed(false, false, false);  // All off initially
+
+  // Check if BOOT button is pressed during startup to reset WiFi
+  if (digitalRead(BOOT_BTN_PIN) == LOW) {
+    DEBUG(Serial.println("\n⚠️  BOOT button pressed - checking for WiFi reset..."));
+    setRGBLed(1, 1, 0);  // Yellow LED to indicate button detected
+
+    // Wait for button to be held for 3 seconds
+    unsigned long pressStart = millis();
+    while (digitalRead(BOOT_BTN_PIN) == LOW && (millis() - pressStart) < 3000) {
+      delay(100);
+    }
+
+    if (millis() - pressStart >= 3000) {
+      resetWiFiRequested = true;
+      DEBUG(Serial.println("✓ BOOT button held for 3 seconds - WiFi will be reset!"));
+      setRGBLed(1, 0, 0);  // Red LED
+    } else {
+      DEBUG(Serial.println("✗ Button released too early - WiFi will not be reset"));
+      setRGBLed(false, false, false);
+    }
+  }
+
+  // Initialize TFT display
+  initTFT();
+
+  // Without a known time there's no clock to show until NTP has answered
+  if (resetWiFiRequested) {
+    showMessage("WIFI RST");
+  } else if (!clockValid) {
+    showMessage("WIFI");
+  }
+
+  publishDisplayState();
+  startTasks();
+  DEBUG(Serial.printf("Setup done in %lu ms, clock %s\n", millis(),
+                      clockValid ? "running" : "waiting for NTP"));
+}
+
+// ======================== MAIN LOOP ========================
+
+void loop() {
+  // All work runs in renderTask and networkTask; the Arduino loop task isn't needed
+  vTaskDelete(NULL);
 }
 
 // ======================== HELPER FUNCTIONS ========================
@@ -2080,5 +4771,5 @@ void configModeCallback(WiFiManager* myWiFiManager) {
   // Set LED to purple (red+blue) for config mode
   setRGBLed(1, 0, 1);
   
-  showMessage("SETUP AP");
+  postMessage("SETUP AP", 0);
 }
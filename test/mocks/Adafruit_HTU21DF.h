@@ -0,0 +1,4 @@
+// Adafruit_HTU21DF.h - Host stand-in for Adafruit HTU21DF driver (native benchmarks)
+#pragma once
+#include "Wire.h"
+class Adafruit_HTU21DF { public: bool begin(TwoWire* = &Wire) { return true; } float readTemperature() { return 0; } float readHumidity() { return 0; } void reset() {} };
@@ -0,0 +1,4 @@
+// Adafruit_SHT31.h - Host stand-in for Adafruit SHT31 driver (native benchmarks)
+#pragma once
+#include "Wire.h"
+class Adafruit_SHT31 { public: Adafruit_SHT31(TwoWire* = &Wire) {} bool begin(uint8_t = 0x44) { return true; } float readTemperature() { return 0; } float readHumidity() { return 0; } bool readBoth(float*, float*) { return true; } };
@@ -0,0 +1,201 @@
+/*
+ * Arduino.h - Host stand-in for the Arduino-ESP32 core (native benchmarks)
+ *
+ * Just enough of the core for src/cyd_tft_clock.cpp to compile and run on
+ * the build machine: String, Serial (silent), ESP, timing, GPIO no-ops and
+ * the FreeRTOS/heap calls the firmware makes. Time comes from the host's
+ * steady clock; getCycleCount() counts nanoseconds at a nominal 1000 MHz so
+ * PerfStat values read as ns.
+ *
+ * The mocks define their globals in the headers, so the firmware and the
+ * benchmark are built as one translation unit (test_main.cpp includes the
+ * firmware source).
+ */
+
+#ifndef MOCK_ARDUINO_H
+#define MOCK_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <sys/time.h>
+#include <string>
+#include <functional>
+#include <algorithm>
+#include <chrono>
+
+using std::min;
+using std::max;
+using std::isnan;
+
+typedef uint8_t byte;
+
+#define PROGMEM
+#define PGM_P const char*
+#define pgm_read_byte(p) (*(const uint8_t*)(p))
+#define pgm_read_word(p) (*(const uint16_t*)(p))
+#define IRAM_ATTR
+#define RTC_NOINIT_ATTR
+
+#define HIGH 1
+#define LOW 0
+#define OUTPUT 1
+#define INPUT 0
+#define INPUT_PULLUP 2
+
+// Binary constants used by the font tables
+#define B00000000 0x00
+#define B00000001 0x01
+#define B00000010 0x02
+#define B00000011 0x03
+#define B00001000 0x08
+#define B00011100 0x1c
+#define B00100000 0x20
+#define B00100100 0x24
+#define B00111110 0x3e
+#define B01000000 0x40
+#define B01000001 0x41
+#define B01000011 0x43
+#define B01011111 0x5f
+#define B01100000 0x60
+#define B01100001 0x61
+#define B01111111 0x7f
+#define B10000000 0x80
+
+#define constrain(x, a, b) ((x) < (a) ? (a) : ((x) > (b) ? (b) : (x)))
+
+// ======================== STRING / PRINT ========================
+
+class String {
+ public:
+  std::string s;
+  String() {}
+  String(const char* c) : s(c ? c : "") {}
+  String(const std::string& c) : s(c) {}
+  String(char c) : s(1, c) {}
+  String(int v) : s(std::to_string(v)) {}
+  String(unsigned v) : s(std::to_string(v)) {}
+  String(long v) : s(std::to_string(v)) {}
+  String(unsigned long v) : s(std::to_string(v)) {}
+  String(float v, int d = 2) { fromFloat(v, d); }
+  String(double v, int d = 2) { fromFloat(v, d); }
+  String& operator+=(const String& o) { s += o.s; return *this; }
+  String& operator+=(const char* o) { s += o; return *this; }
+  String& operator+=(char o) { s += o; return *this; }
+  friend String operator+(const String& a, const String& b) { return String(a.s + b.s); }
+  friend String operator+(const char* a, const String& b) { return String(std::string(a) + b.s); }
+  friend String operator+(const String& a, const char* b) { return String(a.s + b); }
+  bool operator==(const char* o) const { return s == o; }
+  bool operator==(const String& o) const { return s == o.s; }
+  bool operator!=(const char* o) const { return s != o; }
+  const char* c_str() const { return s.c_str(); }
+  unsigned length() const { return s.size(); }
+  int indexOf(char c, unsigned from = 0) const {
+    size_t p = s.find(c, from);
+    return p == std::string::npos ? -1 : (int)p;
+  }
+  String substring(unsigned a, unsigned b = (unsigned)-1) const {
+    return String(s.substr(a, b == (unsigned)-1 ? std::string::npos : b - a));
+  }
+  long toInt() const { return atol(s.c_str()); }
+  void reserve(unsigned n) { s.reserve(n); }
+
+ private:
+  void fromFloat(double v, int d) {
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.*f", d, v);
+    s = buf;
+  }
+};
+
+class Print {
+ public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t) { return 1; }
+  virtual size_t write(const uint8_t*, size_t n) { return n; }
+  size_t print(const char*) { return 0; }
+  size_t print(const String&) { return 0; }
+  size_t print(int) { return 0; }
+  size_t println(const char* = "") { return 0; }
+  size_t println(const String&) { return 0; }
+  size_t println(int) { return 0; }
+  size_t printf(const char*, ...) __attribute__((format(printf, 2, 3))) { return 0; }
+};
+
+class Stream : public Print {
+ public:
+  virtual int available() { return 0; }
+  virtual int read() { return -1; }
+};
+
+class HardwareSerial : public Stream {
+ public:
+  void begin(unsigned long) {}
+};
+
+HardwareSerial Serial;
+
+// ======================== TIMING ========================
+
+inline int64_t mockMicros() {
+  using namespace std::chrono;
+  static const steady_clock::time_point start = steady_clock::now();
+  return duration_cast<microseconds>(steady_clock::now() - start).count();
+}
+
+inline uint64_t mockNanos() {
+  using namespace std::chrono;
+  static const steady_clock::time_point start = steady_clock::now();
+  return (uint64_t)duration_cast<nanoseconds>(steady_clock::now() - start).count();
+}
+
+inline unsigned long millis() { return (unsigned long)(mockMicros() / 1000); }
+inline unsigned long micros() { return (unsigned long)mockMicros(); }
+inline void delay(unsigned long) {}
+inline void delayMicroseconds(unsigned) {}
+inline void yield() {}
+
+inline bool setCpuFrequencyMhz(uint32_t) { return true; }
+inline uint32_t getCpuFrequencyMhz() { return 1000; }
+
+class EspClass {
+ public:
+  uint32_t getFreeHeap() { return 200000; }
+  uint32_t getMinFreeHeap() { return 150000; }
+  uint32_t getMaxAllocHeap() { return 100000; }
+  uint32_t getCpuFreqMHz() { return getCpuFrequencyMhz(); }
+  uint32_t getCycleCount() { return (uint32_t)mockNanos(); }
+  uint32_t getFreeSketchSpace() { return 1310720; }
+  void restart() {}
+};
+
+EspClass ESP;
+
+// ======================== GPIO / MISC ========================
+
+inline void pinMode(int, int) {}
+inline void digitalWrite(int, int) {}
+inline int digitalRead(int) { return HIGH; }
+inline int analogRead(int) { return 0; }
+inline long random(long max) { return max > 0 ? rand() % max : 0; }
+inline long random(long min, long max) { return max > min ? min + rand() % (max - min) : min; }
+inline void randomSeed(unsigned long seed) { srand((unsigned)seed); }
+inline void ledcSetup(int, int, int) {}
+inline void ledcAttachPin(int, int) {}
+inline void ledcWrite(int, int) {}
+
+inline void configTzTime(const char* tz, const char*, const char* = nullptr, const char* = nullptr) {
+  setenv("TZ", tz, 1);
+  tzset();
+}
+
+#include "freertos_mock.h"
+#include "esp_heap_caps.h"
+#include "esp_system.h"
+
+#endif // MOCK_ARDUINO_H
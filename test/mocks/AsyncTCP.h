@@ -0,0 +1,4 @@
+// AsyncTCP.h - Host stand-in for AsyncTCP (native benchmarks; only the type is referenced)
+#pragma once
+#include "Arduino.h"
+class AsyncClient {};
@@ -0,0 +1,3 @@
+/*
+ * DNSServer.h - Empty on the host; only WiFiManager needs it on the device
+ */
@@ -0,0 +1,142 @@
+/*
+ * ESPAsyncWebServer.h - Host stand-in for ESPAsyncWebServer (ESP32Async 3.x)
+ *
+ * Routes registered with on() are kept so a benchmark can call one with
+ * request(uri). The handler runs at once and the response it sends is drained
+ * on the spot, a filler being offered one TCP segment of room per call until
+ * it is done; the status and body bytes end up in lastStatus/responseBytes,
+ * as with the WebServer mock. One request is handled at a time, so responses
+ * live in a single static slot and the mock itself never allocates.
+ */
+
+#pragma once
+#include <map>
+#include "WebServer.h"
+#include "AsyncTCP.h"
+
+#define RESPONSE_TRY_AGAIN  0xFFFFFFFF
+#define MOCK_LENGTH_UNKNOWN ((size_t)-1)
+#define MOCK_SEGMENT_SIZE   1436  // Room offered to a filler per call
+
+typedef std::function<size_t(uint8_t*, size_t, size_t)> AwsResponseFiller;
+
+class AsyncWebServerResponse {
+ public:
+  void setCode(int c) { code = c; }
+  void addHeader(const char*, const char*) {}
+
+  int code = 0;
+  size_t length = 0;         // Body bytes, MOCK_LENGTH_UNKNOWN when chunked
+  AwsResponseFiller filler;  // Empty when the body was given up front
+};
+
+class AsyncWebServerRequest {
+ public:
+  bool hasArg(const char*) const { return false; }
+  String arg(const char*) const { return String(); }
+  String header(const char*) const { return String(); }
+  size_t contentLength() const { return 0; }
+  bool authenticate(const char*, const char*) { return true; }
+  void requestAuthentication() {}
+  void onDisconnect(std::function<void()>) {}
+
+  AsyncWebServerResponse* beginResponse(int code, const char*, const char* body) {
+    return begin(code, strlen(body), AwsResponseFiller());
+  }
+  AsyncWebServerResponse* beginResponse_P(int code, const char*, const uint8_t*, size_t len) {
+    return begin(code, len, AwsResponseFiller());
+  }
+  AsyncWebServerResponse* beginResponse(const char*, size_t len, AwsResponseFiller filler) {
+    return begin(200, len, filler);
+  }
+  AsyncWebServerResponse* beginChunkedResponse(const char*, AwsResponseFiller filler) {
+    return begin(200, MOCK_LENGTH_UNKNOWN, filler);
+  }
+  void send(AsyncWebServerResponse* response) { sent = response; }
+
+  AsyncWebServerResponse* sent = nullptr;
+
+ private:
+  static AsyncWebServerResponse* begin(int code, size_t length, const AwsResponseFiller& filler) {
+    static AsyncWebServerResponse slot;
+    slot.code = code;
+    slot.length = length;
+    slot.filler = filler;
+    return &slot;
+  }
+};
+
+typedef std::function<void(AsyncWebServerRequest*)> ArRequestHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest*, const String&, size_t, uint8_t*, size_t, bool)> ArUploadHandlerFunction;
+
+class AsyncWebHandler { public: virtual ~AsyncWebHandler() {} };
+class AsyncCallbackWebHandler : public AsyncWebHandler {};
+
+class AsyncEventSourceClient {
+ public:
+  void send(const char*, const char* = nullptr, uint32_t = 0, uint32_t = 0) {}
+  void close() {}
+};
+typedef std::function<void(AsyncEventSourceClient*)> ArEventHandlerFunction;
+
+class AsyncEventSource : public AsyncWebHandler {
+ public:
+  explicit AsyncEventSource(const char*) {}
+  void onConnect(ArEventHandlerFunction) {}
+  void send(const char*, const char* = nullptr, uint32_t = 0, uint32_t = 0) {}
+  size_t count() const { return 0; }
+};
+
+class AsyncWebServer {
+ public:
+  explicit AsyncWebServer(uint16_t) {}
+  void begin() {}
+  AsyncCallbackWebHandler& on(const char* uri, ArRequestHandlerFunction fn) {
+    handlers[uri] = fn;
+    return handler;
+  }
+  AsyncCallbackWebHandler& on(const char* uri, HTTPMethod, ArRequestHandlerFunction fn, ArUploadHandlerFunction) {
+    handlers[uri] = fn;
+    return handler;
+  }
+  void onNotFound(ArRequestHandlerFunction) {}
+  AsyncWebHandler& addHandler(AsyncWebHandler* h) { return *h; }
+
+  // Call a registered route and drain its response; false if nothing handles it
+  bool request(const char* uri) {
+    std::map<std::string, ArRequestHandlerFunction>::iterator it = handlers.find(uri);
+    if (it == handlers.end()) return false;
+    lastStatus = 0;
+    responseBytes = 0;
+    AsyncWebServerRequest req;
+    it->second(&req);
+    if (req.sent) drain(*req.sent);
+    return true;
+  }
+
+  int lastStatus = 0;
+  size_t responseBytes = 0;
+
+ private:
+  void drain(AsyncWebServerResponse& response) {
+    lastStatus = response.code;
+    if (!response.filler) {
+      responseBytes = response.length;
+      return;
+    }
+    static uint8_t segment[MOCK_SEGMENT_SIZE];
+    for (;;) {
+      size_t room = sizeof(segment);
+      if (response.length != MOCK_LENGTH_UNKNOWN) {
+        if (responseBytes >= response.length) break;
+        room = std::min(room, response.length - responseBytes);
+      }
+      size_t n = response.filler(segment, room, responseBytes);
+      if (n == 0 || n == RESPONSE_TRY_AGAIN) break;  // Done, or a piece no segment holds
+      responseBytes += n;
+    }
+  }
+
+  std::map<std::string, ArRequestHandlerFunction> handlers;
+  AsyncCallbackWebHandler handler;
+};
@@ -0,0 +1,10 @@
+// IPAddress.h - Host stand-in for IPAddress (native benchmarks)
+#pragma once
+#include "Arduino.h"
+class IPAddress {
+ public:
+  IPAddress() {}
+  IPAddress(uint8_t, uint8_t, uint8_t, uint8_t) {}
+  String toString() const { return String("0.0.0.0"); }
+  operator uint32_t() const { return 0; }
+};
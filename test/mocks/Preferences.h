@@ -0,0 +1,8 @@
+// Preferences.h - Host stand-in for Preferences (NVS) (native benchmarks; always empty)
+#pragma once
+#include "Arduino.h"
+class Preferences { public:
+  bool begin(const char*, bool = false) { return true; } void end() {}
+  size_t getBytesLength(const char*) { return 0; } size_t getBytes(const char*, void*, size_t) { return 0; }
+  size_t putBytes(const char*, const void*, size_t n) { return n; } bool remove(const char*) { return true; } bool clear() { return true; }
+};
@@ -0,0 +1,104 @@
+/*
+ * TFT_eSPI.h - Counting stand-in for the TFT_eSPI driver (native benchmarks)
+ *
+ * Nothing is drawn; every call that would reach the panel is tallied in
+ * tftCounters instead, so a benchmark can report how much SPI traffic a
+ * render path generates as well as how long it takes.
+ *
+ * Bytes model the ILI9341 wire format: an address window is CASET + 4,
+ * PASET + 4 and RAMWR (11 bytes), each pixel is 2 bytes. A transaction is
+ * one startWrite()/endWrite() pair (nested pairs count once, as on the
+ * device); calls made outside one open and close their own.
+ *
+ * Usage:
+ *   tftCounters.reset();
+ *   refreshAll();
+ *   printf("%u windows, %u px\n", tftCounters.windows, tftCounters.pixels);
+ */
+
+#ifndef MOCK_TFT_ESPI_H
+#define MOCK_TFT_ESPI_H
+
+#include "Arduino.h"
+
+#define TFT_BLACK 0x0000
+#define TFT_WHITE 0xFFFF
+
+#define TFT_WINDOW_BYTES 11  // CASET, PASET and RAMWR with their parameters
+
+struct TFTCounters {
+  uint32_t transactions;  // Chip-select assertions
+  uint32_t windows;       // setAddrWindow() calls (column/page/RAM-write commands)
+  uint64_t pixels;        // Pixels written to panel RAM
+  uint64_t bytes;         // Bytes on the SPI bus (commands + pixel data)
+
+  void reset() { memset(this, 0, sizeof(*this)); }
+};
+
+TFTCounters tftCounters = {};
+
+class TFT_eSPI {
+ public:
+  TFT_eSPI(int16_t w = 240, int16_t h = 320) : nativeWidth(w), nativeHeight(h), rotation(0), depth(0) {}
+
+  void init() {}
+  void begin() { init(); }
+  void setRotation(uint8_t r) { rotation = r & 3; }
+  uint8_t getRotation() { return rotation; }
+  int16_t width() { return (rotation & 1) ? nativeHeight : nativeWidth; }
+  int16_t height() { return (rotation & 1) ? nativeWidth : nativeHeight; }
+
+  void startWrite() {
+    if (depth++ == 0) tftCounters.transactions++;
+  }
+  void endWrite() {
+    if (depth > 0) depth--;
+  }
+
+  void setAddrWindow(int32_t, int32_t, int32_t, int32_t) {
+    tftCounters.windows++;
+    tftCounters.bytes += TFT_WINDOW_BYTES;
+  }
+
+  void pushPixels(const void*, uint32_t len) { countPixels(len); }
+  void pushColor(uint16_t, uint32_t len) { countPixels(len); }
+  void pushBlock(uint16_t, uint32_t len) { countPixels(len); }
+
+  void drawPixel(int32_t x, int32_t y, uint32_t color) { fillRect(x, y, 1, 1, color); }
+  void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t) {
+    if (w <= 0 || h <= 0) return;
+    startWrite();
+    setAddrWindow(x, y, w, h);
+    countPixels((uint32_t)w * h);
+    endWrite();
+  }
+  void fillScreen(uint32_t color) { fillRect(0, 0, width(), height(), color); }
+  void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t*) { fillRect(x, y, w, h, 0); }
+
+  void setSwapBytes(bool) {}
+  bool getSwapBytes() { return false; }
+  void writecommand(uint8_t) {}
+
+  // DMA completes immediately, so dmaBusy() is never true
+  bool initDMA(bool = false) { return true; }
+  void deInitDMA() {}
+  void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data, uint16_t* = nullptr) {
+    pushImage(x, y, w, h, data);
+  }
+  void pushPixelsDMA(uint16_t*, uint32_t len) { countPixels(len); }
+  bool dmaBusy() { return false; }
+  void dmaWait() {}
+
+ private:
+  void countPixels(uint32_t len) {
+    tftCounters.pixels += len;
+    tftCounters.bytes += (uint64_t)len * 2;
+  }
+
+  int16_t nativeWidth;
+  int16_t nativeHeight;
+  uint8_t rotation;
+  int depth;
+};
+
+#endif // MOCK_TFT_ESPI_H
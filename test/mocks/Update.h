@@ -0,0 +1,22 @@
+// Update.h - Host stand-in for the ESP32 flash updater (native benchmarks; accepts and discards)
+#pragma once
+#include "Arduino.h"
+#define UPDATE_SIZE_UNKNOWN 0xFFFFFFFF
+#ifndef U_FLASH
+#define U_FLASH 0
+#endif
+class UpdateClass {
+ public:
+  bool begin(size_t = UPDATE_SIZE_UNKNOWN, int = U_FLASH) { running = true; return true; }
+  size_t write(uint8_t*, size_t n) { return n; }
+  bool end(bool = false) { running = false; return true; }
+  void abort() { running = false; }
+  bool hasError() { return false; }
+  uint8_t getError() { return 0; }
+  const char* errorString() { return "No Error"; }
+  bool isRunning() { return running; }
+
+ private:
+  bool running = false;
+};
+UpdateClass Update;
@@ -0,0 +1,73 @@
+/*
+ * WebServer.h - Host stand-in for the Arduino-ESP32 WebServer
+ *
+ * Routes registered with on() are kept so a benchmark can call one with
+ * request(uri); the status and body bytes of the reply are recorded in
+ * lastStatus/responseBytes instead of going to a socket.
+ */
+
+#pragma once
+#include <map>
+#include "WiFi.h"
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+enum HTTPMethod { HTTP_ANY, HTTP_GET, HTTP_HEAD, HTTP_POST, HTTP_PUT };
+enum HTTPUploadStatus { UPLOAD_FILE_START, UPLOAD_FILE_WRITE, UPLOAD_FILE_END, UPLOAD_FILE_ABORTED };
+struct HTTPUpload { HTTPUploadStatus status; String filename; String name; String type; size_t totalSize; size_t currentSize; uint8_t buf[1436]; };
+class RequestHandler { public: virtual ~RequestHandler() {} virtual bool canHandle(HTTPMethod method, String uri) { return false; } };
+class WebServer {
+ public:
+  typedef std::function<void(void)> THandlerFunction;
+  WebServer(int) {}
+  void on(const String& uri, THandlerFunction fn) { handlers[uri.s] = fn; }
+  void on(const String& uri, HTTPMethod, THandlerFunction fn) { handlers[uri.s] = fn; }
+  void on(const String& uri, HTTPMethod, THandlerFunction fn, THandlerFunction) { handlers[uri.s] = fn; }
+  void onNotFound(THandlerFunction) {}
+  void addHandler(RequestHandler*) {}
+  void begin() {}
+  void handleClient() {}
+  void send(int code, const char*, const String& body) { reply(code, body.length()); }
+  void send(int code, const char* = nullptr, const char* body = nullptr) { reply(code, body ? strlen(body) : 0); }
+  void send(int code, const String&, const String& body) { reply(code, body.length()); }
+  void send(int code, const char*, const uint8_t*, size_t len) { reply(code, len); }
+  void send_P(int code, PGM_P, PGM_P body) { reply(code, strlen(body)); }
+  void send_P(int code, PGM_P, PGM_P, size_t len) { reply(code, len); }
+  void sendHeader(const String&, const String&, bool = false) {}
+  void setContentLength(size_t) {}
+  void sendContent(const String& body) { responseBytes += body.length(); }
+  void sendContent(const char*, size_t len) { responseBytes += len; }
+  void sendContent_P(PGM_P, size_t len) { responseBytes += len; }
+  bool hasArg(const String&) { return false; }
+  String arg(const String&) { return String(); }
+  String header(const String&) { return String(); }
+  bool hasHeader(const String&) { return false; }
+  bool authenticate(const char*, const char*) { return true; }
+  void requestAuthentication() {}
+  size_t clientContentLength() { return 0; }
+  void collectHeaders(const char**, size_t) {}
+  HTTPUpload& upload() { static HTTPUpload u; return u; }
+  WiFiClient client() { return WiFiClient(); }
+  HTTPMethod method() { return HTTP_GET; }
+  String uri() { return String(); }
+  void enableDelay(bool) {}
+
+  // Call a registered route; false if nothing handles it
+  bool request(const char* uri) {
+    std::map<std::string, THandlerFunction>::iterator it = handlers.find(uri);
+    if (it == handlers.end()) return false;
+    lastStatus = 0;
+    responseBytes = 0;
+    it->second();
+    return true;
+  }
+
+  int lastStatus = 0;
+  size_t responseBytes = 0;
+
+ private:
+  void reply(int code, size_t len) {
+    lastStatus = code;
+    responseBytes += len;
+  }
+
+  std::map<std::string, THandlerFunction> handlers;
+};
@@ -0,0 +1,65 @@
+// WiFi.h - Host stand-in for the ESP32 WiFi stack (native benchmarks; always connected, no traffic)
+#pragma once
+#include "Arduino.h"
+#include "IPAddress.h"
+#define WL_CONNECTED 3
+#define WL_DISCONNECTED 6
+#define WIFI_STA 1
+#define WIFI_AP 2
+#define WIFI_PS_NONE 0
+#define WIFI_PS_MIN_MODEM 1
+#define WIFI_PS_MAX_MODEM 2
+typedef int wl_status_t;
+typedef int wifi_mode_t;
+typedef int wifi_ps_type_t;
+typedef int arduino_event_id_t;
+typedef int WiFiEvent_t;
+typedef struct { struct { struct { uint8_t reason; } wifi_sta_disconnected; } ; } arduino_event_info_t;
+typedef arduino_event_info_t WiFiEventInfo_t;
+#define ARDUINO_EVENT_WIFI_STA_GOT_IP 7
+#define ARDUINO_EVENT_WIFI_STA_DISCONNECTED 5
+#define ARDUINO_EVENT_WIFI_STA_CONNECTED 4
+class WiFiUDP {
+ public:
+  uint8_t beginMulticast(IPAddress, uint16_t) { return 1; }
+  int beginMulticastPacket() { return 1; }
+  int beginPacket(IPAddress, uint16_t) { return 1; }
+  size_t write(const uint8_t*, size_t n) { return n; }
+  int endPacket() { return 1; }
+  int parsePacket() { return 0; }
+  int read(uint8_t*, size_t) { return 0; }
+  IPAddress remoteIP() { return IPAddress(); }
+  void stop() {}
+};
+class WiFiClient : public Stream {
+ public:
+  bool connected() { return true; }
+  size_t write(const uint8_t*, size_t n) override { return n; }
+  size_t write(uint8_t) override { return 1; }
+  void stop() {}
+  void setNoDelay(bool) {}
+  operator bool() { return true; }
+};
+class WiFiClass {
+ public:
+  IPAddress localIP() { return IPAddress(); }
+  IPAddress gatewayIP() { return IPAddress(); }
+  IPAddress subnetMask() { return IPAddress(); }
+  IPAddress dnsIP() { return IPAddress(); }
+  IPAddress softAPIP() { return IPAddress(); }
+  String SSID() { return String(); }
+  int8_t RSSI() { return 0; }
+  int getMode() { return 0; }
+  bool mode(int) { return true; }
+  wl_status_t status() { return WL_CONNECTED; }
+  bool reconnect() { return true; }
+  bool disconnect(bool = false) { return true; }
+  void setAutoReconnect(bool) {}
+  bool setSleep(bool) { return true; }
+  bool setSleep(int) { return true; }
+  int onEvent(std::function<void(arduino_event_id_t, arduino_event_info_t)>, arduino_event_id_t = 0) { return 0; }
+  int onEvent(void (*)(arduino_event_id_t), arduino_event_id_t = 0) { return 0; }
+  bool begin() { return true; }
+  wl_status_t begin(const char*, const char* = nullptr) { return 0; }
+};
+WiFiClass WiFi;
@@ -0,0 +1,14 @@
+// WiFiManager.h - Host stand-in for WiFiManager (native benchmarks)
+#pragma once
+#include "WiFi.h"
+class WiFiManager {
+ public:
+  void setAPCallback(void (*)(WiFiManager*)) {}
+  void setTimeout(unsigned long) {}
+  void setConfigPortalTimeout(unsigned long) {}
+  void setConnectTimeout(unsigned long) {}
+  void setConfigPortalBlocking(bool) {}
+  void resetSettings() {}
+  bool autoConnect(const char*) { return true; }
+  bool process() { return true; }
+};
@@ -0,0 +1,17 @@
+// Wire.h - Host stand-in for Wire (I2C) (native benchmarks; no devices answer)
+#pragma once
+#include "Arduino.h"
+class TwoWire {
+ public:
+  bool begin(int, int, uint32_t = 0) { return true; }
+  void setClock(uint32_t) {}
+  void setTimeOut(uint16_t) {}
+  void beginTransmission(uint8_t) {}
+  uint8_t endTransmission(bool = true) { return 0; }
+  size_t write(uint8_t) { return 1; }
+  size_t write(const uint8_t*, size_t n) { return n; }
+  uint8_t requestFrom(uint8_t, uint8_t, bool = true) { return 0; }
+  int available() { return 0; }
+  int read() { return 0; }
+};
+TwoWire Wire;
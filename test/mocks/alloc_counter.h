@@ -0,0 +1,54 @@
+/*
+ * alloc_counter.h - Counts heap allocations on the host
+ *
+ * heapAllocations goes up by one for every allocation the process makes,
+ * so a test can read it around a call and assert the call made none. With
+ * glibc, malloc/calloc/realloc are replaced (forwarding to the C library),
+ * which also catches operator new; elsewhere only operator new is counted.
+ * Like the other mocks it defines what it declares, so include it from the
+ * one translation unit the test builds.
+ */
+
+#ifndef MOCK_ALLOC_COUNTER_H
+#define MOCK_ALLOC_COUNTER_H
+
+#include <stdlib.h>
+#include <new>
+
+unsigned long heapAllocations = 0;
+
+#if defined(__GLIBC__)
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+
+void* malloc(size_t size) {
+  heapAllocations++;
+  return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) {
+  heapAllocations++;
+  return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, size_t size) {
+  heapAllocations++;
+  return __libc_realloc(ptr, size);
+}
+}
+#else
+void* operator new(size_t size) {
+  heapAllocations++;
+  void* ptr = malloc(size ? size : 1);
+  if (!ptr) throw std::bad_alloc();
+  return ptr;
+}
+
+void* operator new[](size_t size) { return operator new(size); }
+void operator delete(void* ptr) noexcept { free(ptr); }
+void operator delete[](void* ptr) noexcept { free(ptr); }
+#endif
+
+#endif // MOCK_ALLOC_COUNTER_H
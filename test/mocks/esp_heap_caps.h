@@ -0,0 +1,18 @@
+/*
+ * esp_heap_caps.h - ESP-IDF capability allocator on the host heap
+ */
+
+#ifndef MOCK_ESP_HEAP_CAPS_H
+#define MOCK_ESP_HEAP_CAPS_H
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#define MALLOC_CAP_8BIT 4
+#define MALLOC_CAP_DMA 8
+#define MALLOC_CAP_INTERNAL 2048
+
+inline void* heap_caps_malloc(size_t size, uint32_t) { return malloc(size); }
+inline size_t heap_caps_get_largest_free_block(uint32_t) { return 100000; }
+
+#endif // MOCK_ESP_HEAP_CAPS_H
@@ -0,0 +1,18 @@
+/*
+ * esp_sntp.h - SNTP hooks for the host (no network, callbacks never fire)
+ */
+
+#ifndef MOCK_ESP_SNTP_H
+#define MOCK_ESP_SNTP_H
+
+#include <stdint.h>
+#include <sys/time.h>
+
+typedef void (*sntp_sync_time_cb_t)(struct timeval*);
+
+inline void sntp_set_time_sync_notification_cb(sntp_sync_time_cb_t) {}
+inline void sntp_set_sync_interval(uint32_t) {}
+inline bool sntp_enabled() { return false; }
+inline void sntp_stop() {}
+
+#endif // MOCK_ESP_SNTP_H
@@ -0,0 +1,36 @@
+/*
+ * esp_timer.h - ESP-IDF high resolution timer API for the host
+ *
+ * esp_timer_get_time() follows the host steady clock. Timers can be created
+ * and armed but never fire; the benchmark drives the render path itself.
+ */
+
+#ifndef MOCK_ESP_TIMER_H
+#define MOCK_ESP_TIMER_H
+
+#include "Arduino.h"
+
+typedef struct esp_timer* esp_timer_handle_t;
+typedef void (*esp_timer_cb_t)(void*);
+typedef enum { ESP_TIMER_TASK } esp_timer_dispatch_t;
+
+typedef struct {
+  esp_timer_cb_t callback;
+  void* arg;
+  esp_timer_dispatch_t dispatch_method;
+  const char* name;
+  bool skip_unhandled_events;
+} esp_timer_create_args_t;
+
+#define ESP_OK 0
+
+inline int64_t esp_timer_get_time() { return mockMicros(); }
+inline int esp_timer_create(const esp_timer_create_args_t*, esp_timer_handle_t* handle) {
+  *handle = nullptr;
+  return ESP_OK;
+}
+inline int esp_timer_start_once(esp_timer_handle_t, uint64_t) { return ESP_OK; }
+inline int esp_timer_start_periodic(esp_timer_handle_t, uint64_t) { return ESP_OK; }
+inline int esp_timer_stop(esp_timer_handle_t) { return ESP_OK; }
+
+#endif // MOCK_ESP_TIMER_H
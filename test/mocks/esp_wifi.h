@@ -0,0 +1,11 @@
+// esp_wifi.h - Host stand-in for ESP-IDF WiFi config API (native benchmarks; no saved network)
+#pragma once
+#include <stdint.h>
+#include <string.h>
+typedef enum { WIFI_IF_STA, WIFI_IF_AP } wifi_interface_t;
+typedef struct { uint8_t ssid[32]; uint8_t password[64]; } wifi_sta_config_t;
+typedef union { wifi_sta_config_t sta; } wifi_config_t;
+inline int esp_wifi_get_config(wifi_interface_t, wifi_config_t* config) {
+  memset(config, 0, sizeof(*config));  // No saved network
+  return 0;
+}
@@ -0,0 +1,57 @@
+/*
+ * freertos_mock.h - FreeRTOS calls used by the firmware, as host no-ops
+ *
+ * Tasks are never started on the host: the benchmark calls the render-side
+ * functions directly on its own thread.
+ */
+
+#ifndef MOCK_FREERTOS_H
+#define MOCK_FREERTOS_H
+
+#include <stdint.h>
+
+typedef void* TaskHandle_t;
+typedef void* SemaphoreHandle_t;
+typedef void* QueueHandle_t;
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+typedef uint32_t TickType_t;
+typedef void (*TaskFunction_t)(void*);
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define portMAX_DELAY 0xffffffff
+#define pdMS_TO_TICKS(x) (x)
+#define portTICK_PERIOD_MS 1
+#define portYIELD_FROM_ISR(x) (void)(x)
+
+inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t, const char*, uint32_t, void*, UBaseType_t,
+                                          TaskHandle_t* handle, BaseType_t) {
+  if (handle) *handle = nullptr;
+  return pdPASS;
+}
+inline void vTaskDelay(TickType_t) {}
+inline void vTaskDelayUntil(TickType_t*, TickType_t) {}
+inline void vTaskDelete(TaskHandle_t) {}
+inline TickType_t xTaskGetTickCount() { return 0; }
+inline uint32_t ulTaskNotifyTake(BaseType_t, TickType_t) { return 0; }
+inline BaseType_t xTaskNotifyGive(TaskHandle_t) { return pdPASS; }
+inline void vTaskNotifyGiveFromISR(TaskHandle_t, BaseType_t* woken) {
+  if (woken) *woken = pdFALSE;
+}
+inline BaseType_t xPortGetCoreID() { return 1; }
+
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED 0
+inline void portENTER_CRITICAL(portMUX_TYPE*) {}
+inline void portEXIT_CRITICAL(portMUX_TYPE*) {}
+
+inline SemaphoreHandle_t xSemaphoreCreateMutex() { return (SemaphoreHandle_t)1; }
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t, TickType_t) { return pdTRUE; }
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t) { return pdTRUE; }
+inline SemaphoreHandle_t xSemaphoreCreateRecursiveMutex() { return (SemaphoreHandle_t)1; }
+inline BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t, TickType_t) { return pdTRUE; }
+inline BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t) { return pdTRUE; }
+
+#endif // MOCK_FREERTOS_H
@@ -0,0 +1,287 @@
+/*
+ * test_main.cpp - Render pipeline benchmarks (native)
+ *
+ * Builds the firmware on the host against the mocks in test/mocks and times
+ * the hot paths: single-LED spans in both display styles for every LED
+ * size, a full refreshAll(), the once-a-second update of each display mode,
+ * font width lookups and /api/display serialization. The counting TFT_eSPI
+ * mock adds the SPI traffic each path would put on the wire, which carries
+ * over to the device even though host timings don't. /metrics is also held
+ * to making no heap allocations at all (alloc_counter.h).
+ *
+ * Usage:
+ *   pio test -e native -v        # -v prints the report lines
+ *   pio test -e native_async -v  # Same, built with ASYNC_WEB_SERVER=1
+ */
+
+#include <unity.h>
+#include <chrono>
+#include "alloc_counter.h"
+
+#include "../../src/cyd_tft_clock.cpp"
+
+// ======================== HARNESS ========================
+
+volatile int benchSink;  // Keeps results of pure functions alive
+
+struct BenchResult {
+  double nsPerOp;
+  double pixelsPerOp;
+  double bytesPerOp;
+  double windowsPerOp;
+};
+
+template <typename F>
+BenchResult bench(int iterations, F fn) {
+  tftCounters.reset();
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) fn(i);
+  std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - start;
+
+  BenchResult r;
+  r.nsPerOp = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / iterations;
+  r.pixelsPerOp = (double)tftCounters.pixels / iterations;
+  r.bytesPerOp = (double)tftCounters.bytes / iterations;
+  r.windowsPerOp = (double)tftCounters.windows / iterations;
+  return r;
+}
+
+void report(const char* name, const BenchResult& r) {
+  printf("%-34s %10.1f ns/op %9.1f px/op %9.1f B/op %7.2f win/op\n",
+         name, r.nsPerOp, r.pixelsPerOp, r.bytesPerOp, r.windowsPerOp);
+}
+
+// Render state as setup() leaves it, minus the tasks and the network
+void useGeometry(int style, int size, bool framebuffer) {
+  displayStyle = style;
+  ledSize = size;
+  ledSpacing = 1;
+  waitForDisplayIdle();
+  updateLedLayout();
+  framebufferRelease();
+  if (framebuffer) framebufferBegin();
+  tft.fillScreen(BG_COLOR);
+  forceFullRedraw = true;
+}
+
+// Web routes registered once, against the mock server
+void useRoutes() {
+  static bool routesReady = false;
+  if (!routesReady) {
+    setupWebServer();
+    routesReady = true;
+  }
+}
+
+// Fixed time so every run draws the same glyphs
+void setClock(int h, int m, int s) {
+  hours24 = h;
+  hours = (h % 12) ? h % 12 : 12;
+  minutes = m;
+  seconds = s;
+  day = 14;
+  month = 10;
+  year = 2026;
+}
+
+void tickClock() {
+  if (++seconds < 60) return;
+  seconds = 0;
+  if (++minutes < 60) return;
+  minutes = 0;
+  hours24 = (hours24 + 1) % 24;
+  hours = (hours24 % 12) ? hours24 % 12 : 12;
+}
+
+// Draw and flush one frame the way the render task does
+void renderFrame() {
+  refreshAll();
+  waitForDisplayIdle();
+}
+
+void setUp() {}
+void tearDown() {}
+
+// ======================== BENCHMARKS ========================
+
+// One LED per call, walking the whole matrix with alternating states
+void test_draw_led_span_sizes() {
+  char name[48];
+  for (int style = 0; style <= 1; style++) {
+    for (int fbPath = 0; fbPath <= 1; fbPath++) {
+      for (int size = 4; size <= 12; size++) {
+        useGeometry(style, size, fbPath);
+        if (fbPath && !fb.active) continue;  // Bands don't fit this geometry; drawn direct
+
+        BenchResult r = bench(TOTAL_WIDTH * TOTAL_HEIGHT * 8, [](int i) {
+          int led = i % (TOTAL_WIDTH * TOTAL_HEIGHT);
+          int x = led % TOTAL_WIDTH;
+          drawLEDSpan(x, x, led / TOTAL_WIDTH, (i + led / TOTAL_WIDTH) & 1);
+        });
+        snprintf(name, sizeof(name), "drawLEDSpan %s %s size %d",
+                 style ? "realistic" : "default", fbPath ? "fb" : "direct", size);
+        report(name, r);
+
+        // Direct: one window per visible LED, never more than the LED's pixels.
+        // Framebuffer: nothing reaches the panel until the flush.
+        if (fbPath) {
+          TEST_ASSERT_EQUAL_UINT64(0, tftCounters.bytes);
+        } else {
+          TEST_ASSERT_TRUE(r.windowsPerOp > 0 && r.windowsPerOp <= 1.0);
+          TEST_ASSERT_TRUE(r.pixelsPerOp <= (double)size * size);
+        }
+      }
+    }
+  }
+  waitForDisplayIdle();
+}
+
+// Every LED redrawn, as after a style, size or rotation change
+void test_refresh_all_full() {
+  char name[48];
+  for (int style = 0; style <= 1; style++) {
+    for (int fbPath = 0; fbPath <= 1; fbPath++) {
+      useGeometry(style, DEFAULT_LED_SIZE, fbPath);
+      setClock(10, 8, 30);
+      currentMode = 0;
+      renderCurrentMode();
+
+      BenchResult r = bench(200, [](int) {
+        forceFullRedraw = true;
+        renderFrame();
+      });
+      snprintf(name, sizeof(name), "refreshAll full %s %s",
+               style ? "realistic" : "default", fbPath ? "fb" : "direct");
+      report(name, r);
+      TEST_ASSERT_TRUE(r.pixelsPerOp > 0);
+    }
+  }
+}
+
+// The work of one seconds tick in each mode, after the mode is on screen
+void test_incremental_update_per_mode() {
+  static const char* modeNames[] = { "time+temp", "large time", "time+date" };
+  double directPixels[3] = {};
+  char name[48];
+  for (int fbPath = 0; fbPath <= 1; fbPath++) {
+    for (int mode = 0; mode < 3; mode++) {
+      useGeometry(1, DEFAULT_LED_SIZE, fbPath);
+      currentMode = mode;
+      temperature = 21;
+      humidity = 48;
+      setClock(9, 59, 0);
+      renderCurrentMode();
+      renderFrame();
+
+      BenchResult r = bench(3600, [](int) {
+        tickClock();
+        renderCurrentMode();
+        renderFrame();
+      });
+      snprintf(name, sizeof(name), "tick %s %s", modeNames[mode], fbPath ? "fb" : "direct");
+      report(name, r);
+
+      // A tick touches a few glyphs, not the whole matrix, and the framebuffer
+      // flushes about the same LEDs as drawing them directly
+      if (fbPath) {
+        TEST_ASSERT_TRUE(r.pixelsPerOp < directPixels[mode] * 1.1);
+      } else {
+        directPixels[mode] = r.pixelsPerOp;
+      }
+      forceFullRedraw = true;
+      BenchResult full = bench(1, [](int) { renderFrame(); });
+      TEST_ASSERT_TRUE(r.pixelsPerOp < full.pixelsPerOp);
+    }
+  }
+}
+
+void test_font_widths() {
+  const Font* fonts[] = { &digits7x16, &digits5x16rn, &font3x7, &digits3x5, &digits5x8rn };
+  static const char* fontNames[] = { "digits7x16", "digits5x16rn", "font3x7", "digits3x5", "digits5x8rn" };
+  char name[48];
+
+  for (int f = 0; f < 5; f++) {
+    const Font& font = *fonts[f];
+    BenchResult r = bench(100000, [&font](int i) {
+      benchSink = charWidth((char)(' ' + i % 96), font);
+    });
+    snprintf(name, sizeof(name), "charWidth %s", fontNames[f]);
+    report(name, r);
+
+    r = bench(100000, [&font](int) { benchSink = stringWidth("12:34:56", font); });
+    snprintf(name, sizeof(name), "stringWidth %s", fontNames[f]);
+    report(name, r);
+
+    int expected = -1;
+    for (const char* c = "12:34:56"; *c; c++) expected += charWidth(*c, font) + 1;
+    TEST_ASSERT_EQUAL(expected, stringWidth("12:34:56", font));
+  }
+}
+
+// /api/display JSON and the event-stream frames built from the same snapshot
+void test_display_serialization() {
+  useRoutes();
+
+  useGeometry(1, DEFAULT_LED_SIZE, true);
+  setClock(23, 59, 59);
+  currentMode = 2;
+  renderCurrentMode();
+  renderFrame();
+
+  BenchResult r = bench(20000, [](int) { server.request("/api/display"); });
+  report("/api/display", r);
+  TEST_ASSERT_EQUAL(200, server.lastStatus);
+  TEST_ASSERT_TRUE(server.responseBytes > (size_t)Matrix::SIZE * 2);
+  printf("%-34s %10u bytes\n", "/api/display response", (unsigned)server.responseBytes);
+
+  r = bench(20000, [](int) { server.request("/api/display.bin"); });
+  report("/api/display.bin", r);
+  TEST_ASSERT_EQUAL(200, server.lastStatus);
+
+  frameChannel.update();
+  FrameSnapshot base = frameChannel.front();
+  static char buf[SSE_BUFFER_SIZE];
+  r = bench(20000, [&base](int) { benchSink = formatFrameEvent(buf, sizeof(buf), base); });
+  report("formatFrameEvent", r);
+
+  tickClock();
+  renderCurrentMode();
+  renderFrame();
+  frameChannel.update();
+  FrameSnapshot next = frameChannel.front();
+  r = bench(20000, [&base, &next](int) { benchSink = formatDiffEvent(buf, sizeof(buf), base, next); });
+  report("formatDiffEvent (1s apart)", r);
+  TEST_ASSERT_TRUE(benchSink > 0);
+}
+
+// /metrics is scraped every few seconds for the life of the device, so a
+// scrape must leave the heap alone on either server
+void test_metrics_allocations() {
+  useRoutes();
+  TEST_ASSERT_TRUE(server.request("/metrics"));  // First call may set up statics
+
+  unsigned long before = heapAllocations;
+  BenchResult r = bench(2000, [](int) { server.request("/metrics"); });
+  unsigned long allocations = heapAllocations - before;
+  report("/metrics", r);
+  printf("%-34s %10u bytes %9lu allocations\n", "/metrics response",
+         (unsigned)server.responseBytes, allocations);
+  TEST_ASSERT_EQUAL(200, server.lastStatus);
+  TEST_ASSERT_TRUE(server.responseBytes > 1000);
+  TEST_ASSERT_EQUAL(0, allocations);
+}
+
+int main(int argc, char** argv) {
+  setenv("TZ", "UTC0", 1);
+  tzset();
+  initTFT();
+
+  UNITY_BEGIN();
+  RUN_TEST(test_draw_led_span_sizes);
+  RUN_TEST(test_refresh_all_full);
+  RUN_TEST(test_incremental_update_per_mode);
+  RUN_TEST(test_font_widths);
+  RUN_TEST(test_display_serialization);
+  RUN_TEST(test_metrics_allocations);
+  return UNITY_END();
+}
@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+"""
+build_web.py - Compress web/index.html into include/web_index.h
+
+The dashboard page is served straight from flash as a gzip-encoded asset.
+This script strips indentation and blank lines, stamps a content hash into
+the page (WEB_BUILD) and writes the gzipped bytes out as a PROGMEM array.
+
+Runs automatically before each build via `extra_scripts` in platformio.ini,
+and the header is only rewritten when the page changed. It can also be run
+by hand:
+
+    python3 tools/build_web.py
+"""
+
+import gzip
+import hashlib
+import os
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO/SCons
+    ROOT = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+SOURCE = os.path.join(ROOT, "web", "index.html")
+HEADER = os.path.join(ROOT, "include", "web_index.h")
+BYTES_PER_LINE = 16
+
+
+def minify(text):
+    # Keep line breaks so JavaScript statement boundaries are untouched
+    lines = (line.strip() for line in text.splitlines())
+    return "\n".join(line for line in lines if line)
+
+
+def render_header(build, payload):
+    out = []
+    out.append("/*")
+    out.append(" * web_index.h - Gzipped dashboard page served at /")
+    out.append(" *")
+    out.append(" * GENERATED by tools/build_web.py from web/index.html - do not edit.")
+    out.append(" */")
+    out.append("")
+    out.append("#ifndef WEB_INDEX_H")
+    out.append("#define WEB_INDEX_H")
+    out.append("")
+    out.append("#include <Arduino.h>")
+    out.append("")
+    out.append('#define WEB_INDEX_BUILD "%s"  // Content hash, also used as the ETag' % build)
+    out.append("")
+    out.append("const size_t WEB_INDEX_GZ_LEN = %d;" % len(payload))
+    out.append("const uint8_t WEB_INDEX_GZ[] PROGMEM = {")
+    for i in range(0, len(payload), BYTES_PER_LINE):
+        chunk = payload[i:i + BYTES_PER_LINE]
+        out.append("  " + ", ".join("0x%02x" % b for b in chunk) + ",")
+    out.append("};")
+    out.append("")
+    out.append("#endif // WEB_INDEX_H")
+    out.append("")
+    return "\n".join(out)
+
+
+def main():
+    with open(SOURCE, "r", encoding="utf-8") as f:
+        page = minify(f.read())
+
+    build = hashlib.sha1(page.encode("utf-8")).hexdigest()[:8]
+    page = page.replace("__WEB_BUILD__", build)
+    payload = gzip.compress(page.encode("utf-8"), compresslevel=9, mtime=0)
+    header = render_header(build, payload)
+
+    if os.path.exists(HEADER):
+        with open(HEADER, "r", encoding="utf-8") as f:
+            if f.read() == header:
+                return
+
+    with open(HEADER, "w", encoding="utf-8", newline="\n") as f:
+        f.write(header)
+    print("build_web: %s -> %s (%d bytes gzipped, build %s)" %
+          (os.path.relpath(SOURCE, ROOT), os.path.relpath(HEADER, ROOT), len(payload), build))
+
+
+main()